@@ -24,6 +24,7 @@
 #include "DeltaGliderXR1.h"
 #include "DlgCtrl.h"
 #include "XR1Areas.h"   // for XR1_VCPANEL_TEXTURE_xxx definitions
+#include "FileCacheWarmer.h"
 
 // ==============================================================
 // API callback interface
@@ -45,6 +46,7 @@ DLLCLBK void InitModule (HINSTANCE hModule)
 DLLCLBK void ExitModule (HINSTANCE hModule)
 {
     oapiUnregisterCustomControls(hModule);
+    FileCacheWarmer::Terminate();        // stop warming sound files
 }
 
 // --------------------------------------------------------------
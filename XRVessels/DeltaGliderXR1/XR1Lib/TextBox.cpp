@@ -95,10 +95,9 @@ bool TextBox::Render(HDC hDC, int topY, HFONT font, int lineSpacing, bool forceR
         for (int i = startingLineIndex; i < endingLineIndex; i++)
         {
             const TextLine &line = m_textLineGroup.GetLine(i);
-            const char *pText = line.text.c_str();
 
             SetTextColor(hDC, (line.color == TEXTCOLOR::Normal ? m_normalTextColor : m_highlightTextColor));
-            TextOut(hDC, cx, cy, pText, static_cast<int>(line.text.length()));
+            TextOut(hDC, cx, cy, line.text, line.length);
 
             // drop to next line
             cy += lineSpacing;
@@ -117,15 +116,14 @@ bool TextBox::Render(HDC hDC, int topY, HFONT font, int lineSpacing, bool forceR
 // Constructor
 // maxLines = maximum # of lines to preserve in this line group; after full, the oldest line will be discarded
 TextLineGroup::TextLineGroup(const int maxLines) :
-    m_maxLines(maxLines), m_addLinesCount(0)
+    m_maxLines(maxLines), m_addLinesCount(0), m_firstLineIndex(0), m_lineCount(0)
 {
+    m_pLines = new TextLine[maxLines];
 }
 
 TextLineGroup::~TextLineGroup()
 {
-    // free all TextLine objects in the buffer
-    for (unsigned int i=0; i < m_lines.size(); i++)
-        delete m_lines[i];
+    delete[] m_pLines;
 }
 
 
@@ -135,45 +133,47 @@ void TextLineGroup::AddLines(const char *pStr, bool highlighted)
 {
     m_addLinesCount++;      // text has changed now
 
-    // mark a working copy and parse it into separate lines
-    char temp[MAX_MESSAGE_LENGTH];
-    strcpy(temp, pStr);
-
-    char *pStart = temp;
-    bool cont = true;
-    while (cont)
+    // copy each line directly from the caller's string into the buffer
+    const TEXTCOLOR color = (highlighted ? TEXTCOLOR::Highlighted : TEXTCOLOR::Normal);
+    const char *pStart = pStr;
+    for (;;)
     {
-        char *pEnd = strchr(pStart, '&');
-        if (pEnd)   // found a newline?
+        const char *pEnd = strchr(pStart, '&');
+        if (pEnd == nullptr)   // this is the last line
         {
-            *pEnd = 0;     // terminate line
+            AddLine(pStart, static_cast<int>(strlen(pStart)), color);
+            break;
         }
-        else
-            cont = false;   // this is the last line
 
-        TextLine textLine(pStart, (highlighted ? TEXTCOLOR::Highlighted : TEXTCOLOR::Normal));
-        AddLine(textLine);
-
-        if (pEnd)
-            pStart = pEnd + 1;  // set to start of next line
+        AddLine(pStart, static_cast<int>(pEnd - pStart), color);
+        pStart = pEnd + 1;  // set to start of next line
     }
 }
 
-// Add a line to the buffer, removing the oldest line in the buffer if necessary
-// textLine will be cloned internally by the vector's push_back method
-void TextLineGroup::AddLine(const TextLine &textLine)
+// Add a line to the buffer, overwriting the oldest line in the buffer if necessary
+// length = # of characters to copy from pText; the line is truncated to MAX_TEXTLINE_LENGTH characters
+void TextLineGroup::AddLine(const char *pText, const int length, const TEXTCOLOR color)
 {
-    // lines are stored oldest -> newest; i.e., index #0 has oldest line
-    m_lines.push_back(new TextLine(textLine));  // clone incoming line object
-
-    int lineCount = GetLineCount();
-    if (lineCount > m_maxLines)
+    // lines are stored oldest -> newest, starting at m_firstLineIndex
+    int ringIndex;
+    if (m_lineCount < m_maxLines)
     {
-        lineCount = m_maxLines;  // keep in range
-        // New code
-        // Delete the oldest item in the list (at the front)
-        delete m_lines[0];               // free TextLine object
-        m_lines.erase(m_lines.begin());  // ...and remove the line ptr from the vector
+        ringIndex = m_firstLineIndex + m_lineCount;
+        if (ringIndex >= m_maxLines)
+            ringIndex -= m_maxLines;
+        m_lineCount++;
+    }
+    else
+    {
+        // buffer is full: reuse the oldest line's slot for the new line
+        ringIndex = m_firstLineIndex;
+        if (++m_firstLineIndex >= m_maxLines)
+            m_firstLineIndex = 0;
     }
-}
 
+    TextLine &line = m_pLines[ringIndex];
+    line.length = min(length, MAX_TEXTLINE_LENGTH);
+    memcpy(line.text, pText, line.length);
+    line.text[line.length] = 0;
+    line.color = color;
+}
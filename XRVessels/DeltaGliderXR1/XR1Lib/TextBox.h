@@ -41,47 +41,69 @@ using namespace std;
 
 enum class TEXTCOLOR { Normal, Highlighted };
 
-// line of text to be added to buffer
+// max # of characters in a single line of text, NOT including the terminator; longer lines are truncated.
+// This matches the longest message that fits in a MAX_MESSAGE_LENGTH buffer, so no message that fits there is ever truncated here.
+const int MAX_TEXTLINE_LENGTH = 511;
+
+// line of text in a TextLineGroup's buffer; the text is stored inline so that adding a line never allocates memory
 struct TextLine
 {
-    // Normal constructor
-    TextLine(const char *pText, TEXTCOLOR color) 
-    {
-        this->text = pText;
-        this->color = color;
-    }
+    TextLine() : length(0), color(TEXTCOLOR::Normal) { *text = 0; }
 
-    // NOTE: A copy constructor is required by the 'vector' class.
-    TextLine(const TextLine &that) 
-    {
-        text = that.text;
-        color = that.color;
-    }
-
-    string text;                // text itself
-    TEXTCOLOR color;      // color of line to be rendered
-
-    bool operator=(const TextLine &that) 
-    { 
-        return ((text == that.text) && (color == that.color));
-    }
+    char text[MAX_TEXTLINE_LENGTH + 1];  // text itself
+    int length;                 // strlen(text)
+    TEXTCOLOR color;            // color of line to be rendered
 };
 
-// Manages a group of TextLine objects; this is the primary public object for populating a TextBox
+// Manages a group of TextLine objects; this is the primary public object for populating a TextBox.
+// Lines are stored in a fixed-size ring buffer, so adding a line and discarding the oldest line are both O(1).
 class TextLineGroup
 {
 public:
     TextLineGroup(const int maxLines);
     virtual ~TextLineGroup();
 
-    int GetLineCount() const { return static_cast<int>(m_lines.size()); }
-    void Clear() { m_lines.clear(); }
+    // we own m_pLines, so we cannot be copied
+    TextLineGroup(const TextLineGroup &) = delete;
+    TextLineGroup &operator=(const TextLineGroup &) = delete;
 
-    // retrives lines in buffer
-    const vector<const TextLine *> &GetLines() const { return m_lines; } 
+    int GetLineCount() const { return m_lineCount; }
+    void Clear() { m_lineCount = 0; m_firstLineIndex = 0; m_addLinesCount++; }   // text has changed now
 
-    // retrieves a single line from the buffer
-    const TextLine &GetLine(const int index) const { return *m_lines[index]; }
+    // retrieves a single line from the buffer; index 0 is the oldest line
+    const TextLine &GetLine(const int index) const 
+    { 
+        return m_pLines[GetRingIndex(index)]; 
+    }
+
+    // Forward iterator over the lines in the buffer from oldest to newest; lines are returned by reference, not copied.
+    class LineIterator
+    {
+    public:
+        LineIterator(const TextLineGroup &group, const int index) :
+            m_pLines(group.m_pLines), m_maxLines(group.m_maxLines), m_ringIndex(group.GetRingIndex(index)), m_index(index) { }
+
+        const TextLine &operator*() const  { return m_pLines[m_ringIndex]; }
+        const TextLine *operator->() const { return &m_pLines[m_ringIndex]; }
+        bool operator!=(const LineIterator &other) const { return (m_index != other.m_index); }
+        LineIterator &operator++()
+        {
+            if (++m_ringIndex >= m_maxLines)
+                m_ringIndex = 0;    // wrap around
+            m_index++;
+            return *this;
+        }
+
+    private:
+        const TextLine *m_pLines;
+        int m_maxLines;
+        int m_ringIndex;    // index in m_pLines
+        int m_index;        // line index; 0 = oldest line
+    };
+
+    LineIterator GetLineIterator(const int index) const { return LineIterator(*this, index); }  // index 0 is the oldest line
+    LineIterator begin() const { return LineIterator(*this, 0); }
+    LineIterator end() const   { return LineIterator(*this, m_lineCount); }
 
     // Returns how many times AddLines has been invoked; useful to determine whether
     // text has changed since the last check.
@@ -91,10 +113,22 @@ public:
     virtual void AddLines(const char *pStr, bool highlighted);
 
 protected:
-    void AddLine(const TextLine &textLine);
+    void AddLine(const char *pText, const int length, const TEXTCOLOR color);
+
+    // returns the index in m_pLines of the supplied line index, where 0 is the oldest line
+    int GetRingIndex(const int index) const
+    {
+        int ringIndex = m_firstLineIndex + index;
+        if (ringIndex >= m_maxLines)
+            ringIndex -= m_maxLines;
+        return ringIndex;
+    }
+
     const int m_maxLines;
-    int m_addLinesCount;   // total # of times AddLines invoked
-    vector<const TextLine *> m_lines;  // uses TextLine ptrs for 1) efficiency, and 2) so that vector.erase works
+    int m_addLinesCount;   // incremented each time the text changes: i.e., on each AddLines or Clear
+    TextLine *m_pLines;    // ring buffer of m_maxLines lines; allocated once in the constructor
+    int m_firstLineIndex;  // index in m_pLines of the oldest line
+    int m_lineCount;       // # of lines currently in the buffer
 };
 
 //-------------------------------------------------------------------------
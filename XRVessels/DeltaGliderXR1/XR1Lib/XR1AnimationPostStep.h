@@ -31,27 +31,36 @@
 
 #include "XR1PrePostStep.h"
 
+#include <vector>
+
 class DeltaGliderXR1;
 
+// Animates all of the vessel's doors from a single door table; each XR vessel registers any additional doors it has via AddDoor.
+// The door table is kept as parallel arrays so that the per-frame loop only touches the status of each door until it finds one that is moving.
 class AnimationPostStep : public XR1PrePostStep
 {
 public:
+    // optional vessel methods invoked by the door table
+    typedef void (DeltaGliderXR1::*DoorOpenedMethod)(bool state);     // invoked with 'true' when the door finishes opening; e.g., EnableRetroThrusters
+    typedef void (DeltaGliderXR1::*DoorStateMethod)(double state);    // invoked instead of SetXRAnimation each frame the door moves; e.g., SetGearParameters
+
     AnimationPostStep(DeltaGliderXR1 &vessel);
     virtual void clbkPrePostStep(const double simt, const double simdt, const double mjd);
 
+    void AddDoor(DoorStatus &status, double &proc, const double operatingSpeed, const UINT *pAnim, const int indicatorAreaID,
+        const bool requiresHydraulicPressure = true, DoorOpenedMethod pOnOpened = nullptr, DoorStateMethod pSetState = nullptr);
+
 protected:
-    void AnimateLadder      (const double simt, const double simdt, const double mjd);
-    void AnimateNosecone    (const double simt, const double simdt, const double mjd);
-    void AnimateOuterAirlock(const double simt, const double simdt, const double mjd);
-    void AnimateInnerAirlock(const double simt, const double simdt, const double mjd);
-    void AnimateHatch       (const double simt, const double simdt, const double mjd);
-    void AnimateRadiator    (const double simt, const double simdt, const double mjd);
-    void AnimateRetroDoors  (const double simt, const double simdt, const double mjd);
-    void AnimateHoverDoors  (const double simt, const double simdt, const double mjd);
-    void AnimateScramDoors  (const double simt, const double simdt, const double mjd);
-    void AnimateGear        (const double simt, const double simdt, const double mjd);
-    void AnimateAirbrake    (const double simt, const double simdt, const double mjd);
-    void ManageChamberPressure(const double simt, const double simdt, const double mjd);
-    void AnimateFuelHatch   (const double simt, const double simdt, const double mjd);
-    void AnimateLOXHatch    (const double simt, const double simdt, const double mjd);
+    void AnimateDoors(const double simdt, const bool hydraulicPressurePresent);
+    void UpdateHatchDecompression(const double simt);
+
+    // door table: index = door index
+    vector<DoorStatus *> m_doorStatus;              // points to the vessel's status variable for each door
+    vector<double *> m_doorProc;                    // points to the vessel's proc variable for each door: 0 = closed, 1 = open
+    vector<double> m_doorOperatingSpeed;            // fraction of full travel per second
+    vector<const UINT *> m_doorAnim;                // animation handle member; nullptr = no animation (e.g., airlock chamber pressure)
+    vector<int> m_doorIndicatorAreaID;              // indicator to redraw when the door finishes opening or closing; -1 = none
+    vector<bool> m_doorRequiresHydraulicPressure;   // true if the door cannot move without hydraulic pressure
+    vector<DoorOpenedMethod> m_doorOnOpened;        // may be nullptr
+    vector<DoorStateMethod> m_doorSetState;         // may be nullptr
 };
@@ -30,52 +30,108 @@
 #include "DeltaGliderXR1.h"
 #include "meshres.h"
 
-// Virtual Gateway method that decides which animations are valid for this vessel; if the incoming animation handle is valid, 
+// Gateway method for all animation changes: if the incoming animation handle was registered as valid for this vessel, 
 // the call is propogated up to SetAnimation.  Otherwise, this method returns without changing the animation state.
-// [This check is necessary because if we call SetAnimation with an invalid handle (e.g., 0) the Orbiter core animates the wrong groups or crashes.]
-#define ALLOW(handlePtr)  if (&anim == &(handlePtr)) { SetAnimation(anim, state); return; }
+// Since handles are small sequential integers, validation is a single indexed check that the handle's slot is owned by 
+// the same member variable; SetAnimation is also skipped if the state is unchanged since the last call.
 void DeltaGliderXR1::SetXRAnimation(const UINT &anim, const double state) const
 {
-    ALLOW(anim_gear);         // handle for landing gear animation
-	ALLOW(anim_rcover);       // handle for retro cover animation
-    ALLOW(anim_hoverdoor);    // handle for hover doors animation
-    ALLOW(anim_scramdoor);    // handle for scram doors animation
-	ALLOW(anim_nose);         // handle for nose cone animation
-	ALLOW(anim_ladder);       // handle for front escape ladder animation
-	ALLOW(anim_olock);        // handle for outer airlock animation
-	ALLOW(anim_ilock);        // handle for inner airlock animation
-	ALLOW(anim_hatch);        // handle for top hatch animation
-	ALLOW(anim_radiator);     // handle for radiator animation
-	ALLOW(anim_rudder);       // handle for rudder animation
-	ALLOW(anim_elevator);     // handle for elevator animation
-	ALLOW(anim_elevatortrim); // handle for elevator trim animation
-	ALLOW(anim_laileron);     // handle for left aileron animation
-	ALLOW(anim_raileron);     // handle for right aileron animation
-	ALLOW(anim_brake);        // handle for airbrake animation
+    if ((anim < m_xrAnimationOwners.size()) && (m_xrAnimationOwners[anim] == &anim))
+    {
+        double &lastState = m_xrAnimationStates[anim];
+        if (state != lastState)
+        {
+            SetAnimation(anim, state);
+            lastState = state;
+#ifdef _DEBUG
+            m_setAnimationCallsThisFrame++;
+#endif
+        }
+    }
+}
+
+// Rebuild the animation handle registry used by SetXRAnimation; must be invoked after DefineAnimations.
+void DeltaGliderXR1::BuildXRAnimationRegistry()
+{
+    m_xrAnimationOwners.clear();
+    m_xrAnimationStates.clear();
+    RegisterXRAnimations();     // virtual: each vessel registers its own handles
+}
+
+// Mark the supplied animation handle as valid for this vessel; invoked from RegisterXRAnimations.
+// anim = member variable holding a handle returned by CreateAnimation
+void DeltaGliderXR1::AllowXRAnimation(const UINT &anim)
+{
+    if (anim >= m_xrAnimationOwners.size())
+    {
+        m_xrAnimationOwners.resize(anim + 1, nullptr);
+        m_xrAnimationStates.resize(anim + 1, -1.0);    // -1 = not set yet; never a valid animation state
+    }
+
+    // Each handle may have only one owner.  If two members hold the same handle, one of them was never created: its handle is 
+    // still 0, which belongs to the first animation this vessel created.  Keep the first owner rather than handing its slot to the 
+    // other member, which would make SetXRAnimation silently drop every call for the real animation.
+    const UINT *pOwner = m_xrAnimationOwners[anim];
+    _ASSERTE(pOwner == nullptr);
+    if (pOwner != nullptr)
+    {
+        if (pOwner != &anim)
+        {
+            char msg[256];
+            sprintf(msg, "INTERNAL ERROR: AllowXRAnimation: animation handle %u is already registered by another member variable; was an animation not created?", anim);
+            GetXR1Config()->WriteLog(msg);
+        }
+        return;
+    }
+
+    m_xrAnimationOwners[anim] = &anim;
+}
+
+// Register the animation handles that are valid for this vessel; invoked by BuildXRAnimationRegistry after DefineAnimations.
+// SetXRAnimation ignores any handle not registered here.
+// [This check is necessary because if we call SetAnimation with an invalid handle (e.g., 0) the Orbiter core animates the wrong groups or crashes.]
+void DeltaGliderXR1::RegisterXRAnimations()
+{
+    AllowXRAnimation(anim_gear);         // handle for landing gear animation
+	AllowXRAnimation(anim_rcover);       // handle for retro cover animation
+    AllowXRAnimation(anim_hoverdoor);    // handle for hover doors animation
+    AllowXRAnimation(anim_scramdoor);    // handle for scram doors animation
+	AllowXRAnimation(anim_nose);         // handle for nose cone animation
+	AllowXRAnimation(anim_ladder);       // handle for front escape ladder animation
+	AllowXRAnimation(anim_olock);        // handle for outer airlock animation
+	AllowXRAnimation(anim_ilock);        // handle for inner airlock animation
+	AllowXRAnimation(anim_hatch);        // handle for top hatch animation
+	AllowXRAnimation(anim_radiator);     // handle for radiator animation
+	AllowXRAnimation(anim_rudder);       // handle for rudder animation
+	AllowXRAnimation(anim_elevator);     // handle for elevator animation
+	AllowXRAnimation(anim_elevatortrim); // handle for elevator trim animation
+	AllowXRAnimation(anim_laileron);     // handle for left aileron animation
+	AllowXRAnimation(anim_raileron);     // handle for right aileron animation
+	AllowXRAnimation(anim_brake);        // handle for airbrake animation
 
-	ALLOW(anim_mainthrottle[0]);   // VC main/retro throttle levers (left and right)
-    ALLOW(anim_mainthrottle[1]);   // VC main/retro throttle levers (left and right)
-	ALLOW(anim_hoverthrottle);     // VC hover throttle
-	ALLOW(anim_scramthrottle[0]);  // VC scram throttle levers (left and right)
-    ALLOW(anim_scramthrottle[1]);  // VC scram throttle levers (left and right)
-	ALLOW(anim_gearlever);         // VC gear lever
-	ALLOW(anim_nconelever);        // VC nose cone lever
-	ALLOW(anim_pmaingimbal[0]);    // VC main engine pitch gimbal switch (left and right engine)
-    ALLOW(anim_pmaingimbal[1]);    // VC main engine pitch gimbal switch (left and right engine)
-	ALLOW(anim_ymaingimbal[0]);    // VC main engine yaw gimbal switch (left and right engine)
-    ALLOW(anim_ymaingimbal[1]);    // VC main engine yaw gimbal switch (left and right engine)
-	ALLOW(anim_scramgimbal[0]);    // VC scram engine pitch gimbal switch (left and right engine)
-    ALLOW(anim_scramgimbal[1]);    // VC scram engine pitch gimbal switch (left and right engine)
-	ALLOW(anim_hbalance);          // VC hover balance switch
-	ALLOW(anim_hudintens);         // VC HUD intensity switch
-	ALLOW(anim_rcsdial);           // VC RCS dial animation
-	ALLOW(anim_afdial);            // VC AF dial animation
-	ALLOW(anim_olockswitch);       // VC outer airlock switch animation
-	ALLOW(anim_ilockswitch);       // VC inner airlock switch animation
-	ALLOW(anim_retroswitch);       // VC retro cover switch animation
-	ALLOW(anim_ladderswitch);      // VC ladder switch animation
-	ALLOW(anim_hatchswitch);       // VC hatch switch animation
-	ALLOW(anim_radiatorswitch);    // VC radiator switch animation
+	AllowXRAnimation(anim_mainthrottle[0]);   // VC main/retro throttle levers (left and right)
+    AllowXRAnimation(anim_mainthrottle[1]);   // VC main/retro throttle levers (left and right)
+	AllowXRAnimation(anim_hoverthrottle);     // VC hover throttle
+	AllowXRAnimation(anim_scramthrottle[0]);  // VC scram throttle levers (left and right)
+    AllowXRAnimation(anim_scramthrottle[1]);  // VC scram throttle levers (left and right)
+	AllowXRAnimation(anim_gearlever);         // VC gear lever
+	AllowXRAnimation(anim_nconelever);        // VC nose cone lever
+	AllowXRAnimation(anim_pmaingimbal[0]);    // VC main engine pitch gimbal switch (left and right engine)
+    AllowXRAnimation(anim_pmaingimbal[1]);    // VC main engine pitch gimbal switch (left and right engine)
+	AllowXRAnimation(anim_ymaingimbal[0]);    // VC main engine yaw gimbal switch (left and right engine)
+    AllowXRAnimation(anim_ymaingimbal[1]);    // VC main engine yaw gimbal switch (left and right engine)
+	AllowXRAnimation(anim_scramgimbal[0]);    // VC scram engine pitch gimbal switch (left and right engine)
+    AllowXRAnimation(anim_scramgimbal[1]);    // VC scram engine pitch gimbal switch (left and right engine)
+	AllowXRAnimation(anim_hbalance);          // VC hover balance switch
+	AllowXRAnimation(anim_hudintens);         // VC HUD intensity switch
+	AllowXRAnimation(anim_rcsdial);           // VC RCS dial animation
+	AllowXRAnimation(anim_afdial);            // VC AF dial animation
+	AllowXRAnimation(anim_olockswitch);       // VC outer airlock switch animation
+	AllowXRAnimation(anim_ilockswitch);       // VC inner airlock switch animation
+	AllowXRAnimation(anim_retroswitch);       // VC retro cover switch animation
+	AllowXRAnimation(anim_ladderswitch);      // VC ladder switch animation
+	AllowXRAnimation(anim_hatchswitch);       // VC hatch switch animation
+	AllowXRAnimation(anim_radiatorswitch);    // VC radiator switch animation
 }
 
 // --------------------------------------------------------------
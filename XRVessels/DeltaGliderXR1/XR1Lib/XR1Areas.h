@@ -542,11 +542,12 @@ public:
     class RENDERDATA
     { 
     public:
-        RENDERDATA(int sizeInChars) : forceRedraw(false), value(0), color(COLOR::GREEN) { pStrToRender = new char[sizeInChars + 1]; }
+        RENDERDATA(int sizeInChars) : forceRedraw(false), value(0), resolution(0), color(COLOR::GREEN) { pStrToRender = new char[sizeInChars + 1]; }
         virtual ~RENDERDATA() { delete pStrToRender; }
         // NOTE: do not set value=-999 here!  The string might not be long enough to render it, resulting in a heap overrun.
-        void Reset() { forceRedraw = true; value=0; color = COLOR::GREEN; }
+        void Reset() { forceRedraw = true; value=0; resolution = 0; color = COLOR::GREEN; }
         double value;
+        double resolution;   // display resolution pStrToRender was formatted at; only set by subclasses that use IsDisplayedValueChanged
         char *pStrToRender;  // initialized in constructor
         bool forceRedraw;
         COLOR color;   // defaults to GREEN on initialization
@@ -563,6 +564,27 @@ protected:
     // the subclass must implement this method 
     virtual bool UpdateRenderData(RENDERDATA &renderData) = 0;
 
+    // Returns true if value would display differently than renderData.value at the supplied display resolution (e.g., 0.01 for "%.2f"),
+    // or if a redraw is pending.  Subclasses should check this before formatting their string so that they do not invoke sprintf each frame
+    // for changes that are too small to see, and must save the resolution in renderData.resolution when they render.
+    static bool IsDisplayedValueChanged(const RENDERDATA &renderData, const double value, const double resolution)
+    {
+        if (renderData.forceRedraw)
+            return true;
+
+        // a different resolution means a different format, e.g., 9.99999 -> 10.0000, even if both values round to the same bucket
+        if (resolution != renderData.resolution)
+            return true;
+
+        if (resolution <= 0)
+            return (value != renderData.value);
+
+        return (floor((value / resolution) + 0.5) != floor((renderData.value / resolution) + 0.5));
+    }
+
+    SURFHANDLE GetFontSurface(const COLOR color) const;
+    static void GetGlyph(const char c, int &srcX, int &charWidth);
+
     // data
     SURFHANDLE m_font2Yellow;
     SURFHANDLE m_font2Red;
@@ -573,6 +595,8 @@ protected:
     int m_sizeInChars;
     bool m_hasDecimal;
     RENDERDATA *m_pRenderData;
+    char *m_pLastRenderedText;    // glyph run currently on the panel surface; empty = nothing rendered yet
+    COLOR m_lastRenderedColor;    // color of m_pLastRenderedText
 };
 
 //----------------------------------------------------------------------------------
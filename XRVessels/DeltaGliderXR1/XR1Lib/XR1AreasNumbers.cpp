@@ -30,14 +30,19 @@
 // fontResourceID: e.g., IDB_FONT2 (green version)
 NumberArea::NumberArea(InstrumentPanel& parentPanel, const COORD2 panelCoordinates, const int areaID, int sizeInChars, bool hasDecimal) :
     XR1Area(parentPanel, panelCoordinates, areaID),
-    m_sizeInChars(sizeInChars), m_hasDecimal(hasDecimal), m_font2Yellow(0), m_font2Red(0), m_font2Blue(0), m_font2White(0)
+    m_sizeInChars(sizeInChars), m_hasDecimal(hasDecimal), m_font2Yellow(0), m_font2Red(0), m_font2Blue(0), m_font2White(0),
+    m_lastRenderedColor(COLOR::GREEN)
 {
-    m_pRenderData = new RENDERDATA(sizeInChars + (hasDecimal ? 1 : 0));
+    const int bufferSize = sizeInChars + (hasDecimal ? 1 : 0);
+    m_pRenderData = new RENDERDATA(bufferSize);
+    m_pLastRenderedText = new char[bufferSize + 1];
+    *m_pLastRenderedText = 0;
 }
 
 NumberArea::~NumberArea()
 {
     delete m_pRenderData;
+    delete[] m_pLastRenderedText;
 }
 
 void NumberArea::Activate()
@@ -55,6 +60,7 @@ void NumberArea::Activate()
 
     // force a repaint and defult to normal color
     m_pRenderData->Reset();
+    *m_pLastRenderedText = 0;   // panel surface is new, so nothing is rendered on it yet
 }
 
 void NumberArea::Deactivate()
@@ -66,8 +72,67 @@ void NumberArea::Deactivate()
     XR1Area::Deactivate();  // let superclass clean up
 }
 
+// Returns the font surface for the supplied color
+SURFHANDLE NumberArea::GetFontSurface(const COLOR color) const
+{
+    SURFHANDLE retVal;
+    switch (color)
+    {
+    case COLOR::RED:
+        retVal = m_font2Red;
+        break;
+
+    case COLOR::YELLOW:
+        retVal = m_font2Yellow;
+        break;
+
+    case COLOR::BLUE:
+        retVal = m_font2Blue;
+        break;
+
+    case COLOR::WHITE:
+        retVal = m_font2White;
+        break;
+
+    default:    // GREEN
+        retVal = m_mainSurface;
+        break;
+    }
+
+    return retVal;
+}
+
+// Look up the source X coordinate and width of the supplied character in the font surface.
+// Each char is 7x9, except for '.' (last in the bitmap) which is 3x9.
+// Order is: 0 1 2 3 4 5 6 7 8 9 - ' ' .
+void NumberArea::GetGlyph(const char c, int &srcX, int &charWidth)
+{
+    charWidth = 7;  // assume normal char
+    switch (c)
+    {
+    case '-':
+        srcX = 70;
+        break;
+
+    case ' ':   // blank space
+        srcX = 77;
+        break;
+
+    case '.':   // special narrow '.' char
+        srcX = 84;
+        charWidth = 3;
+        break;
+
+    default:    // 0-9 digit
+        srcX = (c - '0') * 7; // each digit is 7 pixels wide with spacing
+    }
+}
+
 bool NumberArea::Redraw2D(const int event, const SURFHANDLE surf)
 {
+    // UpdateRenderData clears forceRedraw, so save it first
+    const bool forceRedraw = m_pRenderData->forceRedraw;
+
     // invoke subclass method to update the render data
     bool redraw = UpdateRenderData(*m_pRenderData);
 
@@ -75,71 +140,53 @@ bool NumberArea::Redraw2D(const int event, const SURFHANDLE surf)
     {
         // NOTE: no need to render background here; we will overwrite the entire area
 
-        // each char is 7x9, except for '.' (last in the bitmap) which is 5x9
-        // Order is: 0 1 2 3 4 5 6 7 8 9 ' ' .
-
-        char* num = m_pRenderData->pStrToRender;
-        int x = 0;  // X coordinate of next character render
-        for (; *num; num++)
+        // The panel surface retains what we rendered last time (PANEL_MAP_BGONREQUEST), so only re-blit the glyphs in the run that
+        // changed character or position.  A color or length change, or a forced redraw, re-renders the entire run.
+        const char *pText = m_pRenderData->pStrToRender;
+        const char *pLastText = m_pLastRenderedText;
+        const bool isFullRedraw = (forceRedraw || (m_pRenderData->color != m_lastRenderedColor) || (strlen(pText) != strlen(pLastText)));
+        const SURFHANDLE srcSurface = GetFontSurface(m_pRenderData->color);
+
+        int blitCount = 0;
+        int x = 0;      // X coordinate of next character render
+        int lastX = 0;  // X coordinate of the same character index in the previous render
+        for (int i = 0; pText[i]; i++)
         {
-            int srcX;           // X coord into font2.bmp
-            int charWidth = 7;  // assume normal char
-            char c = *num;
-            switch (c)
-            {
-            case '-':
-                srcX = 70;
-                break;
-
-            case ' ':   // blank space
-                srcX = 77;
-                break;
-
-            case '.':   // special narrow '.' char
-                srcX = 84;
-                charWidth = 3;
-                break;
+            int srcX, charWidth;
+            GetGlyph(pText[i], srcX, charWidth);
 
-            default:    // 0-9 digit
-                srcX = (c - '0') * 7; // each digit is 7 pixels wide with spacing
+            if (isFullRedraw || (pText[i] != pLastText[i]) || (x != lastX))
+            {
+                // render separating spaces as well just in case anything underneath (since the font can vary in width now)
+                //                                  srcX,srcY,width,   height
+                DeltaGliderXR1::SafeBlt(surf, srcSurface, x, 0, srcX, 0, charWidth, 9);
+                blitCount++;
             }
+            x += charWidth; // set up for next character
 
-            SURFHANDLE srcSurface;
-            switch (m_pRenderData->color)
+            if (!isFullRedraw)
             {
-            case COLOR::RED:
-                srcSurface = m_font2Red;
-                break;
-
-            case COLOR::YELLOW:
-                srcSurface = m_font2Yellow;
-                break;
-
-            case COLOR::BLUE:
-                srcSurface = m_font2Blue;
-                break;
-
-            case COLOR::WHITE:
-                srcSurface = m_font2White;
-                break;
-
-            default:    // GREEN
-                srcSurface = m_mainSurface;
-                break;
+                int lastSrcX, lastCharWidth;
+                GetGlyph(pLastText[i], lastSrcX, lastCharWidth);
+                lastX += lastCharWidth;
             }
+        }
 
-            // render separating spaces as well just in case anything underneath (since the font can vary in width now)
-            //                                  srcX,srcY,width,   height
-            DeltaGliderXR1::SafeBlt(surf, srcSurface, x, 0, srcX, 0, charWidth, 9);
-            x += charWidth; // set up for next character
+        if (blitCount > 0)
+        {
+            // remember what is on the panel now
+            strcpy(m_pLastRenderedText, pText);
+            m_lastRenderedColor = m_pRenderData->color;
+        }
+        else
+        {
+            redraw = false;     // displayed text and color are unchanged
         }
     }
 
     return redraw;
 }
 
-
-
 //-------------------------------------------------------------------------
 
 ThrustNumberArea::ThrustNumberArea(InstrumentPanel& parentPanel, const COORD2 panelCoordinates, const int areaID) :
@@ -154,36 +201,56 @@ bool ThrustNumberArea::UpdateRenderData(RENDERDATA& renderData)
 
     double thrust = GetThrust();  // retrieve from subclass (in kN)
 
+    // ensure that value is in range
+    if (thrust > 999999)
+        thrust = 999999;   // trim to 6 digits
+    else if (thrust < 0)
+        thrust = 0;       // thrust cannot be negative!
+
+    // note: pFormatStr must evaluate to exactly 7 characters for each case
+    const char* pFormatStr;
+    double resolution;      // smallest change visible with pFormatStr
+    if (thrust > 99999.9)
+    {
+        pFormatStr = "%6.0f.";
+        resolution = 1;
+    }
+    else if (thrust > 9999.99)
+    {
+        pFormatStr = "%5.1f";
+        resolution = 0.1;
+    }
+    else if (thrust > 999.999)
+    {
+        pFormatStr = "%4.2f";
+        resolution = 0.01;
+    }
+    else if (thrust > 99.9999)
+    {
+        pFormatStr = "%3.3f";
+        resolution = 0.001;
+    }
+    else if (thrust > 9.99999)
+    {
+        pFormatStr = "%2.4f";
+        resolution = 0.0001;
+    }
+    else  // <= 9.99999
+    {
+        pFormatStr = "%1.5f";
+        resolution = 0.00001;
+    }
+
     // no need to round here; sprintf will do it for us
 
-    // check whether the value has changed since the last render
-    if (forceRedraw || (thrust != renderData.value))
+    // check whether the value has changed at display precision since the last render
+    if (IsDisplayedValueChanged(renderData, thrust, resolution))
     {
         // Value has changed -- let's redo the string and see if that is different as well.
         // The goal here is to be as efficient as possible and only re-render when we absolutely have to.
         char pTemp[10];
-        // ensure that value is in range
-        if (thrust > 999999)
-            thrust = 999999;   // trim to 6 digits
-        else if (thrust < 0)
-            thrust = 0;       // thrust cannot be negative!
-
-        // note: pFormatStr must evaluate to exactly 7 characters for each case
-        const char* pFormatStr;
-        if (thrust > 99999.9)
-            pFormatStr = "%6.0f.";
-        else if (thrust > 9999.99)
-            pFormatStr = "%5.1f";
-        else if (thrust > 999.999)
-            pFormatStr = "%4.2f";
-        else if (thrust > 99.9999)
-            pFormatStr = "%3.3f";
-        else if (thrust > 9.99999)
-            pFormatStr = "%2.4f";
-        else  // <= 9.99999
-            pFormatStr = "%1.5f";
-
         sprintf(pTemp, pFormatStr, thrust);
+        renderData.resolution = resolution;  // remember the format even if the text is unchanged so we do not sprintf again next frame
         if (forceRedraw || (strcmp(pTemp, renderData.pStrToRender) != 0))
         {
             // text has changed; signal the base class to render it
@@ -431,32 +498,46 @@ bool MassNumberArea::UpdateRenderData(RENDERDATA& renderData)
     if (m_isMetric == false)
         mass = KgToPounds(mass);
 
+    if (mass > 99999999)
+        mass = 99999999;
+    else if (mass < 0)      // sanity-check
+        mass = 0;
+
+    // Note: pFormatString must be exactly nine characters in length, with exactly one decimal.
+    char* pFormatString;
+    double resolution;      // smallest change visible with pFormatString
+    if (mass > 9999999.9)
+    {
+        pFormatString = "%8.0lf.";  // eight because of "." appended = nine total
+        resolution = 1;
+    }
+    else if (mass > 999999.9)
+    {
+        pFormatString = "%9.1lf";   // includes the "."
+        resolution = 0.1;
+    }
+    else if (mass > 99999.99)
+    {
+        pFormatString = "%9.2lf";
+        resolution = 0.01;
+    }
+    else
+    {
+        pFormatString = "%9.3lf";
+        resolution = 0.001;
+    }
+
     // do not round value
 
-    // check whether the value has changed since the last render
-    if (forceRedraw || (mass != renderData.value))
+    // check whether the value has changed at display precision since the last render
+    if (IsDisplayedValueChanged(renderData, mass, resolution))
     {
         // Value has changed -- let's redo the string and see if that is different as well.
         // The goal here is to be as efficient as possible and only re-render when we absolutely have to.
         char pTemp[15];
 
-        if (mass > 99999999)
-            mass = 99999999;
-        else if (mass < 0)      // sanity-check
-            mass = 0;
-
-        // Note: pFormatString must be exactly nine characters in length, with exactly one decimal.
-        char* pFormatString;
-        if (mass > 9999999.9)
-            pFormatString = "%8.0lf.";  // eight because of "." appended = nine total
-        else if (mass > 999999.9)
-            pFormatString = "%9.1lf";   // includes the "."
-        else if (mass > 99999.99)
-            pFormatString = "%9.2lf";
-        else
-            pFormatString = "%9.3lf";
-
         sprintf(pTemp, pFormatString, mass);
+        renderData.resolution = resolution;  // remember the format even if the text is unchanged so we do not sprintf again next frame
         if (forceRedraw || (strcmp(pTemp, renderData.pStrToRender) != 0))
         {
             // text has changed; signal the base class to render it
@@ -105,6 +105,8 @@ XR1ConfigFileParser::XR1ConfigFileParser() :
         pCrewMember->miscID.Format("XI%d", i);      // "XI0", "XI1", etc.
     }
 
+    RegisterProperties();
+
     // write the XR1 version to the log to aid in debugging
     char msg[256];
     sprintf(msg, "Loading %s: %s", VESSELNAME, VERSION);
@@ -122,7 +124,93 @@ XR1ConfigFileParser::~XR1ConfigFileParser()
         delete *it;
 }
 
-// Parse a line; invoked by our superclass
+// Register all properties that can be parsed by our base class without custom code; these are looked up
+// via a sorted table instead of the PNAME_MATCHES chain in ParseLine.
+// Subclasses may register additional properties or override these in their own constructors.
+void XR1ConfigFileParser::RegisterProperties()
+{
+    // [SYSTEM] settings
+    RegisterInt("SYSTEM", "2DPanelWidth", reinterpret_cast<int *>(&TwoDPanelWidth), 0, 3, 0);  // OK to cast enum * to int * here
+
+    // [PASSENGERx] settings
+    for (int i=0; i < MAX_PASSENGERS; i++)
+    {
+        char section[32];
+        sprintf(section, "PASSENGER%d", i);
+        CrewMember *pCrewMember = CrewMembers + i;
+        RegisterString(section, "Name",  pCrewMember->name, CrewMemberNameLength);  // length does NOT include the terminator
+        RegisterInt(section,    "Age",   &pCrewMember->age, 1, 99, 37);
+        RegisterInt(section,    "Pulse", &pCrewMember->pulse, 60, 120, 37);
+        RegisterInt(section,    "Mass",  &pCrewMember->mass, 10, 181, 68);
+        RegisterString(section, "Rank",  pCrewMember->rank, CrewMemberRankLength);
+        RegisterString(section, "Mesh",  pCrewMember->mesh, CrewMemberMeshLength);
+    }
+
+    // [GENERAL] settings
+    RegisterInt("GENERAL",  "DefaultCrewComplement", &DefaultCrewComplement, 0, MAX_PASSENGERS, MAX_PASSENGERS);
+    RegisterBool("GENERAL", "EnableEngineLightingEffects", &EnableEngineLightingEffects);
+    RegisterBool("GENERAL", "EnableParkingBrakes", &EnableParkingBrakes);
+    RegisterBool("GENERAL", "CheatcodesEnabled", &CheatcodesEnabled);
+    RegisterBool("GENERAL", "ShowAltitudeAndVerticalSpeedOnHUD", &ShowAltitudeAndVerticalSpeedOnHUD);
+    RegisterBool("GENERAL", "RequirePilotForShipControl", &RequirePilotForShipControl);
+    RegisterInt("GENERAL",  "MainFuelISP", &MainFuelISP, 0, MAX_MAINFUEL_ISP_CONFIG_OPTION, 2);  // upper limit varies by vessel global
+    RegisterInt("GENERAL",  "SCRAMFuelISP", &SCRAMFuelISP, 0, 4, 0);
+    RegisterInt("GENERAL",  "MainEngineThrust", &MainEngineThrust, 0, 1, 1);
+    RegisterInt("GENERAL",  "HoverEngineThrust", &HoverEngineThrust, 0, 1, 1);
+    RegisterInt("GENERAL",  "SCRAMfhv", &SCRAMfhv, 0, 1, 1);
+    RegisterInt("GENERAL",  "SCRAMdmf", &SCRAMdmf, 0, 1, 1);
+    RegisterInt("GENERAL",  "LOXLoadout", &LOXLoadout, 0, MAX_LOX_LOADOUT_INDEX, 1);
+    RegisterInt("GENERAL",  "LOXConsumptionRate", &LOXConsumptionRate, -1, 4, -1);
+    RegisterInt("GENERAL",  "CoolantHeatingRate", &CoolantHeatingRate, 0, 2, 1);
+    RegisterBool("GENERAL", "WingStressDamageEnabled", &WingStressDamageEnabled);
+    RegisterBool("GENERAL", "HullHeatingDamageEnabled", &HullHeatingDamageEnabled);
+    RegisterBool("GENERAL", "HardLandingsDamageEnabled", &HardLandingsDamageEnabled);
+    RegisterBool("GENERAL", "DoorStressDamageEnabled", &DoorStressDamageEnabled);
+    RegisterBool("GENERAL", "CrashDamageEnabled", &CrashDamageEnabled);
+    RegisterBool("GENERAL", "ScramEngineOverheatDamageEnabled", &ScramEngineOverheatDamageEnabled);
+    RegisterBool("GENERAL", "EnableDamageWhileDocked", &EnableDamageWhileDocked);
+    RegisterBool("GENERAL", "EnableATMThrustReduction", &EnableATMThrustReduction);
+    RegisterBool("GENERAL", "EnableManualFlightControlsForAttitudeHold", &EnableManualFlightControlsForAttitudeHold);
+    RegisterBool("GENERAL", "InvertAttitudeHoldPitchArrows", &InvertAttitudeHoldPitchArrows);
+    RegisterBool("GENERAL", "InvertDescentHoldRateArrows", &InvertDescentHoldRateArrows);
+    RegisterBool("GENERAL", "EnableAudioStatusGreeting", &EnableAudioStatusGreeting);
+    RegisterBool("GENERAL", "EnableVelocityCallouts", &EnableVelocityCallouts);
+    RegisterBool("GENERAL", "EnableAltitudeCallouts", &EnableAltitudeCallouts);
+    RegisterBool("GENERAL", "EnableDockingDistanceCallouts", &EnableDockingDistanceCallouts);
+    RegisterBool("GENERAL", "EnableInformationCallouts", &EnableInformationCallouts);
+    RegisterBool("GENERAL", "EnableRCSStatusCallouts", &EnableRCSStatusCallouts);
+    RegisterBool("GENERAL", "EnableAFStatusCallouts", &EnableAFStatusCallouts);
+    RegisterBool("GENERAL", "EnableWarningCallouts", &EnableWarningCallouts);
+    RegisterBool("GENERAL", "OrbiterAutoRefuelingEnabled", &OrbiterAutoRefuelingEnabled);
+    RegisterColor("GENERAL", "TertiaryHUDNormalColor", &TertiaryHUDNormalColor);
+    RegisterColor("GENERAL", "TertiaryHUDWarningColor", &TertiaryHUDWarningColor);
+    RegisterColor("GENERAL", "TertiaryHUDBackgroundColor", &TertiaryHUDBackgroundColor);
+    RegisterDouble("GENERAL", "DistanceToBaseOnHUDAltitudeThreshold", &DistanceToBaseOnHUDAltitudeThreshold);  // all double values are valid
+    RegisterDouble("GENERAL", "MDAUpdateInterval", &MDAUpdateInterval, 0, 2.0, 0.05);
+    RegisterDouble("GENERAL", "SecondaryHUDUpdateInterval", &SecondaryHUDUpdateInterval, 0, 2.0, 0.05);
+    RegisterDouble("GENERAL", "TertiaryHUDUpdateInterval", &TertiaryHUDUpdateInterval, 0, 2.0, 0.05);
+    RegisterDouble("GENERAL", "ArtificialHorizonUpdateInterval", &ArtificialHorizonUpdateInterval, 0, 2.0, 0.05);
+    RegisterDouble("GENERAL", "PanelUpdateInterval", &PanelUpdateInterval, 0, 2.0, 0.0167);
+    RegisterInt("GENERAL",  "APUFuelBurnRate", &APUFuelBurnRate, 0, 5, 2);
+    RegisterBool("GENERAL", "APUAutoShutdown", &APUAutoShutdown);
+    RegisterBool("GENERAL", "APUAutostartForCOGShift", &APUAutostartForCOGShift);
+    RegisterInt("GENERAL",  "ClearedToLandCallout", &ClearedToLandCallout, 0, 10000, 1500);
+    RegisterBool("GENERAL", "EnableSonicBoom", &EnableSonicBoom);
+    RegisterBool("GENERAL", "Lower2DPanelVerticalScrollingEnabled", &Lower2DPanelVerticalScrollingEnabled);
+
+    // Note: parameters below here are NOT used by the XR1; they are here for subclasses
+    RegisterBool("GENERAL", "EnableResupplyHatchAnimationsWhileDocked", &EnableResupplyHatchAnimationsWhileDocked);
+    RegisterBool("GENERAL", "EnableCustomMainEngineSound", &EnableCustomMainEngineSound);
+    RegisterBool("GENERAL", "EnableCustomHoverEngineSound", &EnableCustomHoverEngineSound);
+    RegisterBool("GENERAL", "EnableCustomRCSSound", &EnableCustomRCSSound);
+    RegisterInt("GENERAL",  "AudioCalloutVolume", &AudioCalloutVolume, 0, 255, 255);
+    RegisterInt("GENERAL",  "CustomMainEngineSoundVolume", &CustomMainEngineSoundVolume, 0, 255, 255);
+    RegisterDouble("GENERAL", "PayloadScreensUpdateInterval", &PayloadScreensUpdateInterval, 0, 2.0, 0.05);
+    RegisterDouble("GENERAL", "LOXConsumptionMultiplier", &LOXConsumptionMultiplier, 0.0, 10.0, 1.0);
+    RegisterBool("GENERAL", "EnableBoilOffExhaustEffect", &EnableBoilOffExhaustEffect);
+}
+
+// Parse a line; invoked by our superclass for any line that does not match a registered property
 // returns: true if line OK, false if error
 bool XR1ConfigFileParser::ParseLine(const char *pSection, const char *pPropertyName, const char *pValue, const bool bParsingOverrideFile)
 {
@@ -134,11 +222,7 @@ bool XR1ConfigFileParser::ParseLine(const char *pSection, const char *pPropertyN
     // parse [SYSTEM] settings
     if (SECTION_MATCHES("SYSTEM"))
     {
-        if (PNAME_MATCHES("2DPanelWidth"))
-        {
-            SSCANF1("%d", &TwoDPanelWidth);
-            VALIDATE_INT(reinterpret_cast<int *>(&TwoDPanelWidth), 0, 3, 0);  // OK to cast enum * to int * here
-        }
+        // all [SYSTEM] settings are registered properties; unknown names are ignored
     }
     // parse [PASSENGERx] settings
     else if (SECTION_STARTSWITH("PASSENGER"))
@@ -154,252 +238,14 @@ bool XR1ConfigFileParser::ParseLine(const char *pSection, const char *pPropertyN
             return false;
         }
 
-        CrewMember *pCrewMember = CrewMembers + passengerNumber;
-        
-        // passenger section OK; let's parse the values
-        if (PNAME_MATCHES("Name"))
-        {
-            STRNCPY(pCrewMember->name, CrewMemberNameLength);  // length does NOT include the terminator
-        }
-        else if (PNAME_MATCHES("Age"))
-        {
-            SSCANF1("%d", &pCrewMember->age);
-            VALIDATE_INT(&pCrewMember->age, 1, 99, 37);
-        }
-        else if (PNAME_MATCHES("Pulse"))
-        {
-            SSCANF1("%d", &pCrewMember->pulse);
-            VALIDATE_INT(&pCrewMember->pulse, 60, 120, 37);
-        }
-        else if (PNAME_MATCHES("Mass"))
-        {
-            SSCANF1("%d", &pCrewMember->mass);
-            VALIDATE_INT(&pCrewMember->mass, 10, 181, 68);
-        }
-        else if (PNAME_MATCHES("Rank"))
-        {
-            STRNCPY(pCrewMember->rank, CrewMemberRankLength);
-        }
-        else if (PNAME_MATCHES("Mesh"))
-        {
-            STRNCPY(pCrewMember->mesh, CrewMemberMeshLength);
-        }
-        else  // invalid value!
-        {
-            goto invalid_name;
-        }
+        // passenger section OK, but all valid names are registered properties
+        goto invalid_name;
     }
     // parse [GENERAL] settings
     else if (SECTION_MATCHES("GENERAL"))
     {
-        if (PNAME_MATCHES("DefaultCrewComplement"))
-        {
-            SSCANF1("%d", &DefaultCrewComplement);
-            VALIDATE_INT(&DefaultCrewComplement, 0, MAX_PASSENGERS, MAX_PASSENGERS);
-        }
-        else if (PNAME_MATCHES("EnableEngineLightingEffects"))
-        {
-			SSCANF_BOOL("%c", &EnableEngineLightingEffects);
-        }
-        else if (PNAME_MATCHES("EnableParkingBrakes"))
-        {
-			SSCANF_BOOL("%c", &EnableParkingBrakes);
-        }
-		else if (PNAME_MATCHES("CheatcodesEnabled"))
-		{
-			SSCANF_BOOL("%c", &CheatcodesEnabled);
-		}
-        else if (PNAME_MATCHES("ShowAltitudeAndVerticalSpeedOnHUD"))
-        {
-			SSCANF_BOOL("%c", &ShowAltitudeAndVerticalSpeedOnHUD);
-        }
-        else if (PNAME_MATCHES("RequirePilotForShipControl"))
-        {
-			SSCANF_BOOL("%c", &RequirePilotForShipControl);
-        }
-        else if (PNAME_MATCHES("MainFuelISP"))
-        {
-            SSCANF1("%d", &MainFuelISP);
-            VALIDATE_INT(&MainFuelISP, 0, MAX_MAINFUEL_ISP_CONFIG_OPTION, 2);
-        }
-        else if (PNAME_MATCHES("SCRAMFuelISP"))
-        {
-            SSCANF1("%d", &SCRAMFuelISP);
-            VALIDATE_INT(&SCRAMFuelISP, 0, 4, 0);
-        }
-        else if (PNAME_MATCHES("MainEngineThrust"))
-        {
-            SSCANF1("%d", &MainEngineThrust);
-            VALIDATE_INT(&MainEngineThrust, 0, 1, 1);
-        }
-        else if (PNAME_MATCHES("HoverEngineThrust"))
-        {
-            SSCANF1("%d", &HoverEngineThrust);
-            VALIDATE_INT(&HoverEngineThrust, 0, 1, 1);
-        }
-        else if (PNAME_MATCHES("SCRAMfhv"))
-        {
-            SSCANF1("%d", &SCRAMfhv);
-            VALIDATE_INT(&SCRAMfhv, 0, 1, 1);
-        }
-        else if (PNAME_MATCHES("SCRAMdmf"))
-        {
-            SSCANF1("%d", &SCRAMdmf);
-            VALIDATE_INT(&SCRAMdmf, 0, 1, 1);
-        }
-        else if (PNAME_MATCHES("LOXLoadout"))
-        {
-            SSCANF1("%d", &LOXLoadout);
-            VALIDATE_INT(&LOXLoadout, 0, MAX_LOX_LOADOUT_INDEX, 1);
-        }
-        else if (PNAME_MATCHES("LOXConsumptionRate"))
-        {
-            SSCANF1("%d", &LOXConsumptionRate);
-            VALIDATE_INT(&LOXConsumptionRate, -1, 4, -1);
-        }
-        else if (PNAME_MATCHES("CoolantHeatingRate"))
-        {
-            SSCANF1("%d", &CoolantHeatingRate);
-            VALIDATE_INT(&CoolantHeatingRate, 0, 2, 1);
-        }
-        else if (PNAME_MATCHES("WingStressDamageEnabled"))
-        {
-			SSCANF_BOOL("%c", &WingStressDamageEnabled);
-        }
-        else if (PNAME_MATCHES("HullHeatingDamageEnabled"))
-        {
-			SSCANF_BOOL("%c", &HullHeatingDamageEnabled);
-        }
-        else if (PNAME_MATCHES("HardLandingsDamageEnabled"))
-        {
-			SSCANF_BOOL("%c", &HardLandingsDamageEnabled);
-        }
-        else if (PNAME_MATCHES("DoorStressDamageEnabled"))
-        {
-			SSCANF_BOOL("%c", &DoorStressDamageEnabled);
-        }
-        else if (PNAME_MATCHES("CrashDamageEnabled"))
-        {
-			SSCANF_BOOL("%c", &CrashDamageEnabled);
-        }
-        else if (PNAME_MATCHES("ScramEngineOverheatDamageEnabled"))
-        {
-			SSCANF_BOOL("%c", &ScramEngineOverheatDamageEnabled);
-        }
-        else if (PNAME_MATCHES("EnableDamageWhileDocked"))
-        {
-			SSCANF_BOOL("%c", &EnableDamageWhileDocked);
-        }
-        else if (PNAME_MATCHES("EnableATMThrustReduction"))
-        {
-			SSCANF_BOOL("%c", &EnableATMThrustReduction);
-        }
-        else if (PNAME_MATCHES("EnableManualFlightControlsForAttitudeHold"))
-        {
-			SSCANF_BOOL("%c", &EnableManualFlightControlsForAttitudeHold);
-        }
-        else if (PNAME_MATCHES("InvertAttitudeHoldPitchArrows"))
-        {
-			SSCANF_BOOL("%c", &InvertAttitudeHoldPitchArrows);
-        }
-        else if (PNAME_MATCHES("InvertDescentHoldRateArrows"))
-        {
-			SSCANF_BOOL("%c", &InvertDescentHoldRateArrows);
-        }
-        else if (PNAME_MATCHES("EnableAudioStatusGreeting"))
-        {
-			SSCANF_BOOL("%c", &EnableAudioStatusGreeting);
-        }
-        else if (PNAME_MATCHES("EnableVelocityCallouts"))
-        {
-			SSCANF_BOOL("%c", &EnableVelocityCallouts);
-        }
-        else if (PNAME_MATCHES("EnableAltitudeCallouts"))
-        {
-			SSCANF_BOOL("%c", &EnableAltitudeCallouts);
-        }
-        else if (PNAME_MATCHES("EnableDockingDistanceCallouts"))
-        {
-			SSCANF_BOOL("%c", &EnableDockingDistanceCallouts);
-        }
-        else if (PNAME_MATCHES("EnableInformationCallouts"))
-        {
-			SSCANF_BOOL("%c", &EnableInformationCallouts);
-        }
-        else if (PNAME_MATCHES("EnableRCSStatusCallouts"))
-        {
-			SSCANF_BOOL("%c", &EnableRCSStatusCallouts);
-        }
-        else if (PNAME_MATCHES("EnableAudioStatusGreeting"))
-        {
-			SSCANF_BOOL("%c", &EnableAudioStatusGreeting);
-        }
-        else if (PNAME_MATCHES("EnableAFStatusCallouts"))
-        {
-			SSCANF_BOOL("%c", &EnableAFStatusCallouts);
-        }
-        else if (PNAME_MATCHES("EnableWarningCallouts"))
-        {
-			SSCANF_BOOL("%c", &EnableWarningCallouts);
-        }
-        else if (PNAME_MATCHES("OrbiterAutoRefuelingEnabled"))
-        {
-			SSCANF_BOOL("%c", &OrbiterAutoRefuelingEnabled);
-        }
-        else if (PNAME_MATCHES("TertiaryHUDNormalColor"))
-        {
-            int r,g,b = 128;    // fall back to gray if bytes invalid
-            SSCANF3("%d,%d,%d", &r, &g, &b);
-            TertiaryHUDNormalColor = CREF3(r,g,b); // convert to Windows CREF
-        }
-        else if (PNAME_MATCHES("TertiaryHUDWarningColor"))
-        {
-            int r,g,b = 128;    // fall back to gray if bytes invalid
-            SSCANF3("%d,%d,%d", &r, &g, &b);
-            TertiaryHUDWarningColor = CREF3(r,g,b); // convert to Windows CREF
-        }
-        else if (PNAME_MATCHES("TertiaryHUDBackgroundColor"))
-        {
-            int r,g,b = 128;    // fall back to gray if bytes invalid
-            SSCANF3("%d,%d,%d", &r, &g, &b);
-            TertiaryHUDBackgroundColor = CREF3(r,g,b); // convert to Windows CREF
-        }
-        else if (PNAME_MATCHES("DistanceToBaseOnHUDAltitudeThreshold"))
-        {
-            SSCANF1("%lf", &DistanceToBaseOnHUDAltitudeThreshold);
-            // no validation on this: all double values are valid
-        }
-        else if (PNAME_MATCHES("MDAUpdateInterval"))
-        {
-            SSCANF1("%lf", &MDAUpdateInterval);
-            VALIDATE_DOUBLE(&MDAUpdateInterval, 0, 2.0, 0.05);
-        }
-        else if (PNAME_MATCHES("SecondaryHUDUpdateInterval"))
-        {
-            SSCANF1("%lf", &SecondaryHUDUpdateInterval);
-            VALIDATE_DOUBLE(&SecondaryHUDUpdateInterval, 0, 2.0, 0.05);
-        }
-        else if (PNAME_MATCHES("TertiaryHUDUpdateInterval"))
-        {
-            SSCANF1("%lf", &TertiaryHUDUpdateInterval);
-            VALIDATE_DOUBLE(&TertiaryHUDUpdateInterval, 0, 2.0, 0.05);
-        }
-        else if (PNAME_MATCHES("ArtificialHorizonUpdateInterval"))
-        {
-            SSCANF1("%lf", &ArtificialHorizonUpdateInterval);
-            VALIDATE_DOUBLE(&ArtificialHorizonUpdateInterval, 0, 2.0, 0.05);
-        }
-        else if (PNAME_MATCHES("PanelUpdateInterval"))
-        {
-            SSCANF1("%lf", &PanelUpdateInterval);
-            VALIDATE_DOUBLE(&PanelUpdateInterval, 0, 2.0, 0.0167);
-        }
-        else if (PNAME_MATCHES("APUFuelBurnRate"))
-        {
-            SSCANF1("%d", &APUFuelBurnRate);
-            VALIDATE_INT(&APUFuelBurnRate, 0, 5, 2);
-        }
-        else if (PNAME_MATCHES("APUIdleRuntimeCallouts"))
+        // all other [GENERAL] settings are registered properties
+        if (PNAME_MATCHES("APUIdleRuntimeCallouts"))
         {
             SSCANF1("%d", &APUIdleRuntimeCallouts);
             if (APUIdleRuntimeCallouts != 0)    // 0 is permitted
@@ -408,14 +254,6 @@ bool XR1ConfigFileParser::ParseLine(const char *pSection, const char *pPropertyN
                 VALIDATE_INT(&APUIdleRuntimeCallouts, 5, 600, 20);
             }
         }
-        else if (PNAME_MATCHES("APUAutoShutdown"))
-        {
-			SSCANF_BOOL("%c", &APUAutoShutdown);
-        }
-        else if (PNAME_MATCHES("APUAutostartForCOGShift"))
-        {
-			SSCANF_BOOL("%c", &APUAutostartForCOGShift);
-        }
         else if (PNAME_MATCHES("AllowGroundResupply"))
         {
             if (ParseFuelTanks(pValue, AllowGroundResupply) == false)
@@ -445,65 +283,6 @@ bool XR1ConfigFileParser::ParseLine(const char *pSection, const char *pPropertyN
             else
                 strncpy(TouchdownCallout, pValue, MAX_FILENAME_LEN);
         }
-        else if (PNAME_MATCHES("ClearedToLandCallout"))
-        {
-            SSCANF1("%d", &ClearedToLandCallout);
-            VALIDATE_INT(&ClearedToLandCallout, 0, 10000, 1500);
-        }
-        else if (PNAME_MATCHES("EnableSonicBoom"))
-        {
-			SSCANF_BOOL("%c", &EnableSonicBoom);
-        }
-        // Note: parameters below here are NOT used by the XR1; they are here for subclasses
-        else if (PNAME_MATCHES("EnableResupplyHatchAnimationsWhileDocked"))
-        {
-			SSCANF_BOOL("%c", &EnableResupplyHatchAnimationsWhileDocked);
-        }
-        else if (PNAME_MATCHES("EnableCustomMainEngineSound"))
-        {
-			SSCANF_BOOL("%c", &EnableCustomMainEngineSound);
-        }
-        else if (PNAME_MATCHES("EnableCustomHoverEngineSound"))
-        {
-			SSCANF_BOOL("%c", &EnableCustomHoverEngineSound);
-        }
-        else if (PNAME_MATCHES("EnableCustomRCSSound"))
-        {
-			SSCANF_BOOL("%c", &EnableCustomRCSSound);
-        }
-        else if (PNAME_MATCHES("AudioCalloutVolume"))
-        {
-            SSCANF1("%d", &AudioCalloutVolume);
-            VALIDATE_INT(&AudioCalloutVolume, 0, 255, 255);
-        }
-        else if (PNAME_MATCHES("CustomMainEngineSoundVolume"))
-        {
-            SSCANF1("%d", &CustomMainEngineSoundVolume);
-            VALIDATE_INT(&CustomMainEngineSoundVolume, 0, 255, 255);
-        }
-        else if (PNAME_MATCHES("MainFuelISP"))  
-        {
-            SSCANF1("%d", &MainFuelISP);
-            VALIDATE_INT(&MainFuelISP, 0, MAX_MAINFUEL_ISP_CONFIG_OPTION, 2);  // upper limit varies by vessel global
-        }
-        else if (PNAME_MATCHES("PayloadScreensUpdateInterval"))
-        {
-            SSCANF1("%lf", &PayloadScreensUpdateInterval);
-            VALIDATE_DOUBLE(&PayloadScreensUpdateInterval, 0, 2.0, 0.05);
-        }
-        else if (PNAME_MATCHES("LOXConsumptionMultiplier"))
-        {
-            SSCANF1("%lf", &LOXConsumptionMultiplier);
-            VALIDATE_DOUBLE(&LOXConsumptionMultiplier, 0.0, 10.0, 1.0);
-        }
-        else if (PNAME_MATCHES("EnableBoilOffExhaustEffect"))
-        {
-			SSCANF_BOOL("%c", &EnableBoilOffExhaustEffect);
-        }
-        else if (PNAME_MATCHES("Lower2DPanelVerticalScrollingEnabled"))
-        {
-			SSCANF_BOOL("%c", &Lower2DPanelVerticalScrollingEnabled);
-        }
         else    // unknown parameter name
         {
             goto invalid_name;
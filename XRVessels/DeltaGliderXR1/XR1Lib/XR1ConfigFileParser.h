@@ -262,6 +262,7 @@ public:
 protected:
     void AddCheatcode(const char *pName, const double value, double *ptr1, double *ptr2 = nullptr);
 
+    void RegisterProperties();
     virtual bool ParseLine(const char *pSection, const char *pName, const char *pValue, const bool bParsingOverrideFile);
     bool ParseFuelTanks(const char *pValue, bool *pConfigArray);
 
@@ -158,12 +158,29 @@ public:
     virtual bool isOn();    
     virtual void SetHUDColors();
     virtual void RenderCell(HDC hDC, SecondaryHUDMode &secondaryHUD, const int row, const int column, const int topY);
-    virtual void PopulateCell(SecondaryHUDMode::Cell &cell);
 
 protected:
+    // the value most recently formatted for a single cell position; if the value's displayed digits are unchanged, the text is reused as-is
+    struct CellCache
+    {
+        CellCache() : scaledValue(0), isNegative(false), decimals(-1), pSuffix(nullptr), forceSign(false) { *valueStr = 0; }
+
+        __int64 scaledValue;    // value * 10^decimals, rounded; i.e., the digits on the screen
+        bool isNegative;
+        int decimals;           // -1 = nothing cached
+        const char *pSuffix;    // units suffix; always points to a static string
+        bool forceSign;
+        char valueStr[MAX_CELL_VALUE_LENGTH + 1];
+    };
+
+    virtual void PopulateCell(SecondaryHUDMode::Cell &cell, CellCache &cache);
+    static void FormatCellValue(CellCache &cache, char *pValueStrOut, const double value, const int decimals, const char *pSuffix, const bool forceSign = false);
+    static bool QuantizeFixed(const double value, const int decimals, __int64 &scaledValueOut);
+
     HFONT m_mainFont;
     int m_lineSpacing;  // pixels between text lines
     int m_lastHUDMode;  // 1-5
+    CellCache m_cellCache[SH_ROW_COUNT][2];  // index = row, column
 };
 
 //----------------------------------------------------------------------------------
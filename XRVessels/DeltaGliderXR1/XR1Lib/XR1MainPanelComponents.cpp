@@ -412,7 +412,7 @@ HorizontalGaugeArea::RENDERDATA ScramDiffuserTempHorizontalGaugeArea::GetRenderD
     XR1Ramjet *pXR1Ramjet = GetXR1().ramjet;
     const int engine = ((GetAreaID() == AID_SCRAMTEMP_LBAR) ? 0 : 1);
     
-    double thLevel = GetVessel().GetThrusterLevel(pXR1Ramjet->thdef[engine]->th); // throttle level
+    double thLevel = GetVessel().GetThrusterLevel(pXR1Ramjet->GetThrusterHandle(engine)); // throttle level
     double Td;  // diffuser temp
 
     // get the diffuser temp
@@ -445,7 +445,7 @@ bool ScramDiffuserTempNumberArea::UpdateRenderData(RENDERDATA &renderData)
     XR1Ramjet *pXR1Ramjet = GetXR1().ramjet;
     const int engine = ((GetAreaID() == AID_SCRAMTEMP_LTEXT) ? 0 : 1);
 
-    double thLevel = GetVessel().GetThrusterLevel(pXR1Ramjet->thdef[engine]->th); // throttle level
+    double thLevel = GetVessel().GetThrusterLevel(pXR1Ramjet->GetThrusterHandle(engine)); // throttle level
     double Td;  // diffuser temp
 
     // get the diffuser temp
@@ -503,7 +503,7 @@ bool PayloadThumbnailArea::Redraw2D(const int event, const SURFHANDLE surf)
 GrapplePayloadArea::GrapplePayloadArea(InstrumentPanel &parentPanel, const COORD2 panelCoordinates, const int areaID, const int idbGrapplePayload) :
     XR1Area(parentPanel, panelCoordinates, areaID),
     m_hSurface(nullptr), m_hFont(0), 
-    m_idbGrapplePayload(idbGrapplePayload)
+    m_idbGrapplePayload(idbGrapplePayload), m_isScreenRendered(false)
 {
     m_rangeButton      = _COORD2(  4, 100);   
     m_grappleButton    = _COORD2(  4, 115);
@@ -525,6 +525,7 @@ void GrapplePayloadArea::Activate()
     m_hSurface = CreateSurface(m_idbGrapplePayload);
     
     m_hFont = CreateFont(12, 0, 0, 0, 600, 0, 0, 0, 0, 0, 0, 0, FF_MODERN, "Microsoft Sans Serif");
+    m_isScreenRendered = false;  // surface contents are unknown until the next full render
 }
  
 void GrapplePayloadArea::Deactivate()
@@ -535,6 +536,17 @@ void GrapplePayloadArea::Deactivate()
     XR1Area::Deactivate();  // invoke superclass method
 }
 
+// Set the contents of this field; the text is truncated if it exceeds the buffer
+void GrapplePayloadArea::TextField::Set(const int fieldX, const int fieldY, const COLORREF fieldColor, const char *pText)
+{
+    x = fieldX;
+    y = fieldY;
+    color = fieldColor;
+    strncpy(text, pText, sizeof(text) - 1);
+    text[sizeof(text) - 1] = 0;
+    length = static_cast<int>(strlen(text));
+}
+
 bool GrapplePayloadArea::Redraw2D(const int event, const SURFHANDLE surf)
 {
     if (GetXR1().m_internalSystemsFailure)  
@@ -543,26 +555,18 @@ bool GrapplePayloadArea::Redraw2D(const int event, const SURFHANDLE surf)
         // Note: given how rarely this condition occurs it is not worth tracking whether we already blitted a blank screen; 
         // therefore, we always re-blit it.
         oapiBltPanelAreaBackground(GetAreaID(), surf);  // background is a black screen (from the panel bitmap)
+        m_isScreenRendered = false;     // must re-render everything once systems are back online
         return true;       
     }
 
-    // Always re-render everything; it is too error-prone to try to track all values and clear any 
-    // old data underneath from the previous render.
-        
-    // render the background based on whether the ship is landed and STOPPED (background changes)
-    DeltaGliderXR1::SafeBlt(surf, m_hSurface, 0, 0, 0, 0, s_screenSize.x, s_screenSize.y);
+    // First format every field's text and color for this frame; then we only touch the surface for fields that changed
+    // since the last render.  A changed field is erased by re-blitting the background bitmap under its old text.
+    TextField fields[FIELD_COUNT];
 
     // get the targeted vessel, if any; may be null!
     const XRGrappleTargetVessel *pGrappleTargetVessel = GetXR1().GetGrappleTargetVessel(GetXR1().m_grappleTargetVesselName);  // pulls cached object w/updated distance, delta-V, etc. (this logic is in the framework classes)
 
-    // obtain device context and save existing font
-    HDC hDC = GetDC(surf);
-    HFONT hPrevObject = (HFONT)SelectObject(hDC, m_hFont);
-
-    SetBkMode(hDC, TRANSPARENT);
-    SetTextColor(hDC, CREF(LIGHT_YELLOW));  // use CREF macro to convert to Windows' Blue, Green, Red COLORREF
-    SetTextAlign(hDC, TA_LEFT);
-
+    const COLORREF defaultColor = CREF(LIGHT_YELLOW);  // use CREF macro to convert to Windows' Blue, Green, Red COLORREF
     int textY = 0;
     const int pitch = 12;
     char msg[128];
@@ -577,12 +581,12 @@ bool GrapplePayloadArea::Redraw2D(const int event, const SURFHANDLE surf)
         const XRPayloadClassData &grappleTargetPCD = pGrappleTargetVessel->GetTargetPCD();  // will never be null
 
         // DESC
-        TextOut(hDC, 39, textY, grappleTargetPCD.GetDescription(), static_cast<int>(strlen(grappleTargetPCD.GetDescription())));  // length may exceed displayable area; this is OK
+        fields[FIELD_DESCRIPTION].Set(39, textY, defaultColor, grappleTargetPCD.GetDescription());  // length may exceed displayable area; this is OK
 
         // MASS
         textY += pitch;
         sprintf(msg, "%.2f kg", pTargetVessel->GetMass());
-        TextOut(hDC, 39, textY, msg, static_cast<int>(strlen(msg)));
+        fields[FIELD_MASS].Set(39, textY, defaultColor, msg);
 
         // DISTANCE
         textY += pitch;
@@ -597,10 +601,7 @@ bool GrapplePayloadArea::Redraw2D(const int event, const SURFHANDLE surf)
             dwColor = BRIGHT_YELLOW;
         else
             dwColor = MEDIUM_GREEN;
-        
-        SetTextColor(hDC, CREF(dwColor));
-        TextOut(hDC, 61, textY, msg, static_cast<int>(strlen(msg)));
-        SetTextColor(hDC, CREF(LIGHT_YELLOW));  // restore default color
+        fields[FIELD_DISTANCE].Set(61, textY, CREF(dwColor), msg);
 
         // DELTA-V
         textY += pitch;
@@ -613,29 +614,23 @@ bool GrapplePayloadArea::Redraw2D(const int event, const SURFHANDLE surf)
             dwColor = BRIGHT_YELLOW;
         else
             dwColor = MEDIUM_GREEN;
-        
-        SetTextColor(hDC, CREF(dwColor));  // restore default color
-        TextOut(hDC, 53, textY, msg, static_cast<int>(strlen(msg)));
-        SetTextColor(hDC, CREF(LIGHT_YELLOW));  // restore default color
+        fields[FIELD_DELTAV].Set(53, textY, CREF(dwColor), msg);
 
         // DIMENSIONS
         textY += pitch;
         VECTOR3 dim = grappleTargetPCD.GetDimensions();
         sprintf(msg, "%.2f L x %.2f W x %.2f H", dim.z, dim.x, dim.y); 
-        TextOut(hDC, 74, textY, msg, static_cast<int>(strlen(msg)));
+        fields[FIELD_DIMENSIONS].Set(74, textY, defaultColor, msg);
 
         // MODULE NAME
         textY += pitch;
-        const char *pName = pTargetVessel->GetName();
-        SetTextColor(hDC, CREF(CYAN));  // so user can find it instantly
-        TextOut(hDC, 85, textY, pName, static_cast<int>(strlen(pName)));
-        SetTextColor(hDC, CREF(LIGHT_YELLOW));  // restore default color
+        fields[FIELD_NAME].Set(85, textY, CREF(CYAN), pTargetVessel->GetName());  // cyan so user can find it instantly
 
         // SLOTS OCCUPIED
         textY += pitch;
         VECTOR3 slots = grappleTargetPCD.GetSlotsOccupied();  
         sprintf(msg, "%.1f L x %.1f W x %.1f H", slots.z, slots.x, slots.y); 
-        TextOut(hDC, 98, textY, msg, static_cast<int>(strlen(msg)));
+        fields[FIELD_SLOTS].Set(98, textY, defaultColor, msg);
     }
     else
         textY += (6 * pitch);
@@ -644,7 +639,7 @@ bool GrapplePayloadArea::Redraw2D(const int event, const SURFHANDLE surf)
     // get the current selected slot, if any
     XRPayloadBay *pPayloadBay = GetXR1().m_pPayloadBay;
     const int selectedSlot = GetXR1().m_selectedSlot;  // 0 = NONE
-    const VESSEL *pChildVessel = ((selectedSlot == 0) ? nullptr : pPayloadBay->GetChild(GetXR1().m_selectedSlot));
+    COLORREF slotColor = defaultColor;
 
     if (selectedSlot > 0)
     {
@@ -655,25 +650,23 @@ bool GrapplePayloadArea::Redraw2D(const int event, const SURFHANDLE surf)
         {
             // A grapple target is selected; check slot space and obtain list of slots required for the targeted grapple vessel
             VESSEL *pTargetVessel = pGrappleTargetVessel->GetTargetVessel();  // will never be null here
-            vector<XRPayloadBaySlot *> vOut; // will contain list of slots required for targeted vessel
-            // ORG: const bool wouldFit = pSlot->GetRequiredNeighborSlotsForCandidateVessel(*pTargetVessel, vOut);
             
             // check whether the slot itself or any of the *required* slots are occupied
             const bool wouldFit = pSlot->CheckSlotSpace(*pTargetVessel);
             if (pSlot->IsOccupied())
             {
                 sprintf(msg, "%d (OCCUPIED)", selectedSlot);
-                SetTextColor(hDC, CREF(LIGHT_RED));  // use CREF macro to convert to Windows' Blue, Green, Red COLORREF
+                slotColor = CREF(LIGHT_RED);
             }
             else if (wouldFit == false)
             {
                 sprintf(msg, "%d (NO ROOM)", selectedSlot);
-                SetTextColor(hDC, CREF(LIGHT_RED));  // use CREF macro to convert to Windows' Blue, Green, Red COLORREF
+                slotColor = CREF(LIGHT_RED);
             }
             else
             {
                 // slot is OK; render in green
-                SetTextColor(hDC, CREF(MEDIUM_GREEN));  // use CREF macro to convert to Windows' Blue, Green, Red COLORREF
+                slotColor = CREF(MEDIUM_GREEN);
                 sprintf(msg, "%d (OK)", selectedSlot);
             }
         }
@@ -698,16 +691,16 @@ bool GrapplePayloadArea::Redraw2D(const int event, const SURFHANDLE surf)
         strcpy(msg, "NONE");
     }
     
-    // render the 'selected bay slot' value
+    // the 'selected bay slot' value
     textY += pitch;
-    TextOut(hDC, 118, textY, msg, static_cast<int>(strlen(msg)));
-    SetTextColor(hDC, CREF(LIGHT_YELLOW));  // revert to default color
+    fields[FIELD_SELECTED_SLOT].Set(118, textY, slotColor, msg);
 
     // RANGE
     sprintf(msg, "%.0f m", range);    // e.g., "500 m"
-    TextOut(hDC, 84, 98, msg, static_cast<int>(strlen(msg)));
+    fields[FIELD_RANGE].Set(84, 98, defaultColor, msg);
 
     // target X of Y
+    COLORREF targetColor = defaultColor;
     const int totalVesselsInRange = static_cast<int>(GetXR1().m_xrGrappleTargetVesselsInDisplayRange.size());
     if (isGrappleTargetValidAndInRange == false)   // no target selected or it is not in range?
     {
@@ -735,16 +728,75 @@ bool GrapplePayloadArea::Redraw2D(const int event, const SURFHANDLE surf)
         }
 
         // render in green
-        SetTextColor(hDC, CREF(MEDIUM_GREEN));  // use CREF macro to convert to Windows' Blue, Green, Red COLORREF
+        targetColor = CREF(MEDIUM_GREEN);
         sprintf(msg, "%d of %d in range", index+1, totalVesselsInRange);
     }
+    fields[FIELD_TARGET].Set(52, 128, targetColor, msg);
 
-    TextOut(hDC, 52, 128, msg, static_cast<int>(strlen(msg)));
+    // Now determine what must be redrawn
+    bool isFieldChanged[FIELD_COUNT];
+    const bool isFullRender = ((event == PANEL_REDRAW_INIT) || !m_isScreenRendered);
+    if (isFullRender)
+    {
+        // render the background, which holds all the static labels and buttons
+        DeltaGliderXR1::SafeBlt(surf, m_hSurface, 0, 0, 0, 0, s_screenSize.x, s_screenSize.y);
+        for (int i = 0; i < FIELD_COUNT; i++)
+            isFieldChanged[i] = true;
+    }
+    else
+    {
+        bool isAnyFieldChanged = false;
+        for (int i = 0; i < FIELD_COUNT; i++)
+        {
+            const TextField &rendered = m_renderedFields[i];
+            isFieldChanged[i] = !(fields[i] == rendered);
+            if (isFieldChanged[i] && (rendered.renderedWidth > 0))
+            {
+                // erase the old text by restoring the background under it; this must be done before we obtain the DC below
+                const int width = min(rendered.renderedWidth + 2, s_screenSize.x - rendered.x);  // allow for overhang on the last character
+                const int height = min(pitch, s_screenSize.y - rendered.y);
+                DeltaGliderXR1::SafeBlt(surf, m_hSurface, rendered.x, rendered.y, rendered.x, rendered.y, width, height);
+            }
+            isAnyFieldChanged |= isFieldChanged[i];
+        }
+
+        if (!isAnyFieldChanged)
+            return false;   // screen is unchanged
+    }
+
+    // obtain device context and save existing font
+    HDC hDC = GetDC(surf);
+    HFONT hPrevObject = (HFONT)SelectObject(hDC, m_hFont);
+
+    SetBkMode(hDC, TRANSPARENT);
+    SetTextAlign(hDC, TA_LEFT);
+
+    for (int i = 0; i < FIELD_COUNT; i++)
+    {
+        if (!isFieldChanged[i])
+            continue;
+
+        TextField &rendered = m_renderedFields[i];
+        rendered = fields[i];
+        rendered.renderedWidth = 0;
+        if (rendered.length > 0)
+        {
+            SetTextColor(hDC, rendered.color);
+            TextOut(hDC, rendered.x, rendered.y, rendered.text, rendered.length);
+
+            SIZE size;
+            if (GetTextExtentPoint32(hDC, rendered.text, rendered.length, &size))
+                rendered.renderedWidth = size.cx;
+            else
+                rendered.renderedWidth = s_screenSize.x;  // erase the rest of the line next time
+        }
+    }
 
     // restore previous font and release device context
     SelectObject(hDC, hPrevObject);
     ReleaseDC(surf, hDC);
 
+    m_isScreenRendered = true;
     return true;
 }
 
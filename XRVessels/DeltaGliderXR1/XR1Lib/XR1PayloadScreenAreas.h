@@ -119,6 +119,27 @@ protected:
     // no way to do this: COORD2 m_trackButton;
 
     SURFHANDLE m_hSurface;  
+
+    // text fields on the screen; the labels and buttons are part of the background bitmap
+    enum FIELD { FIELD_DESCRIPTION, FIELD_MASS, FIELD_DISTANCE, FIELD_DELTAV, FIELD_DIMENSIONS, FIELD_NAME, FIELD_SLOTS, 
+                 FIELD_SELECTED_SLOT, FIELD_RANGE, FIELD_TARGET, FIELD_COUNT };
+
+    // a single text field; a field is re-rendered only when its text or color changes
+    struct TextField
+    {
+        TextField() : x(0), y(0), color(0), length(0), renderedWidth(0) { *text = 0; }
+        void Set(const int fieldX, const int fieldY, const COLORREF fieldColor, const char *pText);
+        bool operator==(const TextField &other) const { return ((x == other.x) && (y == other.y) && (color == other.color) && (length == other.length) && (memcmp(text, other.text, length) == 0)); }
+
+        int x, y;
+        COLORREF color;
+        char text[128];     // empty = field not shown
+        int length;
+        int renderedWidth;  // width in pixels of this text on the screen; 0 = nothing rendered
+    };
+
+    TextField m_renderedFields[FIELD_COUNT];    // fields as of the last render
+    bool m_isScreenRendered;                    // false = background and all fields must be re-rendered
 };
 
 //----------------------------------------------------------------------------------
@@ -69,9 +69,14 @@ class SetHullTempsPostStep : public XR1PrePostStep
 public:
     SetHullTempsPostStep(DeltaGliderXR1 &vessel);
     virtual void clbkPrePostStep(const double simt, const double simdt, const double mjd);
+    virtual bool GetProfilerDetails(char *pBuffer, const int bufferLength) const;
 
 protected:
-    void RemoveSurfaceHeat(const double simdt, double &temp);
+    // leading-edge heating pattern followed by a hull surface
+    enum class HeatSource { Nosecone, LeftWing, RightWing, Cockpit, Count };
+
+    void AddHullSurface(double &temp, const HeatSource heatSource, const double heatScale);
+    void RemoveSurfaceHeat(const double simdt, const double extTemp, double &temp);
 
     virtual void AddHeat(const double simdt);
     virtual void RemoveHeat(const double simdt);
@@ -79,6 +84,25 @@ protected:
     virtual int GetHeatingMeshGroupIndex() { return 0; }  // typical heating mesh will only have one group anyway
 
     bool m_forceTempUpdate;
+
+    // hull surface table: index = surface index
+    vector<double *> m_surfaceTemp;             // points to the vessel's temperature variable for each surface
+    vector<HeatSource> m_surfaceHeatSource;     // heating pattern this surface follows
+    vector<double> m_surfaceHeatScale;          // fraction of its heat source's heat that reaches this surface
+
+    // heating mesh state most recently sent to the graphics client; reset whenever the heating mesh instance changes
+    static const int MAX_HEATING_ALPHA_LEVEL = 15;  // heating mesh uses 4-bit alpha, so there are only 16 distinct levels
+    DEVMESHHANDLE m_hLastHeatingMesh;   // heating mesh instance the state below applies to
+    unsigned int m_lastHeatingMeshVersion;  // vessel's m_heatingMeshVersion when m_hLastHeatingMesh was obtained
+    bool m_isLastHeatingMeshVisibleValid;
+    bool m_lastHeatingMeshVisible;
+    int m_lastHeatingAlphaLevel;        // 0 - MAX_HEATING_ALPHA_LEVEL; -1 = material not set yet
+
+    // heating mesh update counts for the profiler report
+    unsigned int m_visibilityUpdateCount;
+    unsigned int m_visibilitySkipCount;
+    unsigned int m_materialUpdateCount;
+    unsigned int m_materialSkipCount;
 };
 
 //---------------------------------------------------------------------------
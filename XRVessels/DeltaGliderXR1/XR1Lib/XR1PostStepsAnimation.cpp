@@ -29,214 +29,109 @@
 AnimationPostStep::AnimationPostStep(DeltaGliderXR1 &vessel) : 
     XR1PrePostStep(vessel)
 {
+    DeltaGliderXR1 &xr1 = GetXR1();
+
+    //      status                proc                speed                      animation            indicator area ID
+    AddDoor(xr1.ladder_status,    xr1.ladder_proc,    LADDER_OPERATING_SPEED,    &xr1.anim_ladder,    AID_LADDERINDICATOR);
+    AddDoor(xr1.nose_status,      xr1.nose_proc,      NOSE_OPERATING_SPEED,      &xr1.anim_nose,      AID_NOSECONEINDICATOR);
+    AddDoor(xr1.olock_status,     xr1.olock_proc,     AIRLOCK_OPERATING_SPEED,   &xr1.anim_olock,     AID_OUTERDOORINDICATOR);
+    AddDoor(xr1.ilock_status,     xr1.ilock_proc,     AIRLOCK_OPERATING_SPEED,   &xr1.anim_ilock,     AID_INNERDOORINDICATOR);
+    AddDoor(xr1.hatch_status,     xr1.hatch_proc,     HATCH_OPERATING_SPEED,     &xr1.anim_hatch,     AID_HATCHINDICATOR);
+    AddDoor(xr1.radiator_status,  xr1.radiator_proc,  RADIATOR_OPERATING_SPEED,  &xr1.anim_radiator,  AID_RADIATORINDICATOR);
+    AddDoor(xr1.rcover_status,    xr1.rcover_proc,    RCOVER_OPERATING_SPEED,    &xr1.anim_rcover,    AID_RETRODOORINDICATOR, true, &DeltaGliderXR1::EnableRetroThrusters);
+    AddDoor(xr1.hoverdoor_status, xr1.hoverdoor_proc, HOVERDOOR_OPERATING_SPEED, &xr1.anim_hoverdoor, AID_HOVERDOORINDICATOR, true, &DeltaGliderXR1::EnableHoverEngines);
+    AddDoor(xr1.scramdoor_status, xr1.scramdoor_proc, SCRAMDOOR_OPERATING_SPEED, &xr1.anim_scramdoor, AID_SCRAMDOORINDICATOR, true, &DeltaGliderXR1::EnableScramEngines);
+    AddDoor(xr1.gear_status,      xr1.gear_proc,      GEAR_OPERATING_SPEED,      nullptr,             AID_GEARINDICATOR,      true, nullptr, &DeltaGliderXR1::SetGearParameters);  // will set animation state as well
+    AddDoor(xr1.brake_status,     xr1.brake_proc,     AIRBRAKE_OPERATING_SPEED,  &xr1.anim_brake,     -1);
+
+    // NOTE: This is not actually animation; however, the airlock chamber does pressurize / depressurize at a fixed speed like a door and so it handled here
+    AddDoor(xr1.chamber_status,   xr1.chamber_proc,   CHAMBER_OPERATING_SPEED,   nullptr,             AID_CHAMBERINDICATOR,   false);
 }
 
-void AnimationPostStep::clbkPrePostStep(const double simt, const double simdt, const double mjd)
+// Add a door to the door table.
+// status, proc = vessel's status and proc variables for this door
+// operatingSpeed = fraction of full travel per second
+// pAnim = animation handle member to update as the door moves, or nullptr for none
+// indicatorAreaID = indicator area to redraw when the door finishes opening or closing, or -1 for none
+// requiresHydraulicPressure = true if the door cannot move without hydraulic pressure
+// pOnOpened = vessel method invoked with 'true' when the door finishes opening, or nullptr for none
+// pSetState = vessel method invoked with the door's proc each frame the door moves instead of setting pAnim, or nullptr to use pAnim
+void AnimationPostStep::AddDoor(DoorStatus &status, double &proc, const double operatingSpeed, const UINT *pAnim, const int indicatorAreaID,
+    const bool requiresHydraulicPressure, DoorOpenedMethod pOnOpened, DoorStateMethod pSetState)
 {
-    // animate doors that require hydraulic pressure
-    if (GetXR1().CheckHydraulicPressure(false, false))     // do not log a warning nor play an error beep here!  We are merely querying the state.
-    {
-        AnimateLadder      (simt, simdt, mjd);
-        AnimateNosecone    (simt, simdt, mjd);
-        AnimateOuterAirlock(simt, simdt, mjd);
-        AnimateInnerAirlock(simt, simdt, mjd);
-        AnimateHatch       (simt, simdt, mjd);
-        AnimateRadiator    (simt, simdt, mjd);
-        AnimateRetroDoors  (simt, simdt, mjd);
-        AnimateHoverDoors  (simt, simdt, mjd);
-        AnimateScramDoors  (simt, simdt, mjd);
-        AnimateGear        (simt, simdt, mjd);
-        AnimateAirbrake    (simt, simdt, mjd);
-    }
-
-    // animate doors that do NOT require hydraulic pressure
-    ManageChamberPressure(simt, simdt, mjd);
+    m_doorStatus.push_back(&status);
+    m_doorProc.push_back(&proc);
+    m_doorOperatingSpeed.push_back(operatingSpeed);
+    m_doorAnim.push_back(pAnim);
+    m_doorIndicatorAreaID.push_back(indicatorAreaID);
+    m_doorRequiresHydraulicPressure.push_back(requiresHydraulicPressure);
+    m_doorOnOpened.push_back(pOnOpened);
+    m_doorSetState.push_back(pSetState);
 }
 
-void AnimationPostStep::AnimateLadder(const double simt, const double simdt, const double mjd)
+void AnimationPostStep::clbkPrePostStep(const double simt, const double simdt, const double mjd)
 {
-    // animate escape ladder
-    if (GetXR1().ladder_status >= DoorStatus::DOOR_CLOSING)  // closing or opening
-    {
-        double da = simdt * LADDER_OPERATING_SPEED;
-        if (GetXR1().ladder_status == DoorStatus::DOOR_CLOSING)
-        {
-            if (GetXR1().ladder_proc > 0.0)
-                GetXR1().ladder_proc = max(0.0, GetXR1().ladder_proc - da);
-            else
-            {
-                GetXR1().ladder_status = DoorStatus::DOOR_CLOSED;
-                GetVessel().TriggerRedrawArea(AID_LADDERINDICATOR);
-            }
-        } 
-        else    // door is opening or open
-        {
-            if (GetXR1().ladder_proc < 1.0)
-                GetXR1().ladder_proc = min (1.0, GetXR1().ladder_proc + da);
-            else
-            {
-                GetXR1().ladder_status = DoorStatus::DOOR_OPEN;
-                GetVessel().TriggerRedrawArea(AID_LADDERINDICATOR);
-            }
-        }
-        GetXR1().SetXRAnimation(GetXR1().anim_ladder, GetXR1().ladder_proc);
-    }
-}
+    // doors that require hydraulic pressure only move if it is present
+    const bool hydraulicPressurePresent = GetXR1().CheckHydraulicPressure(false, false);     // do not log a warning nor play an error beep here!  We are merely querying the state.
+    AnimateDoors(simdt, hydraulicPressurePresent);
 
-//---------------------------------------------------------------------------
-
-void AnimationPostStep::AnimateNosecone(const double simt, const double simdt, const double mjd)
-{
-    if (GetXR1().nose_status >= DoorStatus::DOOR_CLOSING)
-    {
-        double da = simdt * NOSE_OPERATING_SPEED;
-        if (GetXR1().nose_status == DoorStatus::DOOR_CLOSING)
-        {
-            if (GetXR1().nose_proc > 0.0)  // animation
-                GetXR1().nose_proc = max (0.0, GetXR1().nose_proc-da);
-            else
-            {
-                GetXR1().nose_status = DoorStatus::DOOR_CLOSED;
-                GetVessel().TriggerRedrawArea(AID_NOSECONEINDICATOR);
-            }
-        } 
-        else   // door opening
-        {   
-            if (GetXR1().nose_proc < 1.0)
-                GetXR1().nose_proc = min (1.0, GetXR1().nose_proc+da);
-            else 
-            {
-                GetXR1().nose_status = DoorStatus::DOOR_OPEN;
-                GetVessel().TriggerRedrawArea(AID_NOSECONEINDICATOR);
-            }
-        }
-        GetXR1().SetXRAnimation(GetXR1().anim_nose, GetXR1().nose_proc);
-    }
+    if (hydraulicPressurePresent)
+        UpdateHatchDecompression(simt);
 }
 
-//---------------------------------------------------------------------------
-
-void AnimationPostStep::AnimateOuterAirlock(const double simt, const double simdt, const double mjd)
+// Move each door that is opening or closing and update its animation
+void AnimationPostStep::AnimateDoors(const double simdt, const bool hydraulicPressurePresent)
 {
-    if (GetXR1().olock_status >= DoorStatus::DOOR_CLOSING)
+    DeltaGliderXR1 &xr1 = GetXR1();
+    const int doorCount = static_cast<int>(m_doorStatus.size());
+    for (int i = 0; i < doorCount; i++)
     {
-        double da = simdt * AIRLOCK_OPERATING_SPEED;
-        if (GetXR1().olock_status == DoorStatus::DOOR_CLOSING)
-        {
-            if (GetXR1().olock_proc > 0.0)
-                GetXR1().olock_proc = max (0.0, GetXR1().olock_proc-da);
-            else
-            {
-                GetXR1().olock_status = DoorStatus::DOOR_CLOSED;
-                GetVessel().TriggerRedrawArea(AID_OUTERDOORINDICATOR);
-            }
-        } 
-        else   // door opening
-        { 
-            if (GetXR1().olock_proc < 1.0)
-                GetXR1().olock_proc = min (1.0, GetXR1().olock_proc+da);
-            else
-            {
-                GetXR1().olock_status = DoorStatus::DOOR_OPEN;
-                GetVessel().TriggerRedrawArea(AID_OUTERDOORINDICATOR);
-            }
-        }
-        GetXR1().SetXRAnimation(GetXR1().anim_olock, GetXR1().olock_proc);
-    }
-}
+        DoorStatus &status = *m_doorStatus[i];
+        if (status < DoorStatus::DOOR_CLOSING)
+            continue;   // door is not moving
 
-//---------------------------------------------------------------------------
+        if (m_doorRequiresHydraulicPressure[i] && !hydraulicPressurePresent)
+            continue;   // door is stuck until hydraulic pressure returns
 
-void AnimationPostStep::AnimateInnerAirlock(const double simt, const double simdt, const double mjd)
-{
-    if (GetXR1().ilock_status >= DoorStatus::DOOR_CLOSING)
-    {
-        double da = simdt * AIRLOCK_OPERATING_SPEED;
-        if (GetXR1().ilock_status == DoorStatus::DOOR_CLOSING)
+        double &proc = *m_doorProc[i];
+        const double da = simdt * m_doorOperatingSpeed[i];
+        if (status == DoorStatus::DOOR_CLOSING)
         {
-            if (GetXR1().ilock_proc > 0.0)
-                GetXR1().ilock_proc = max (0.0, GetXR1().ilock_proc-da);
+            if (proc > 0.0)
+                proc = max(0.0, proc - da);
             else
             {
-                GetXR1().ilock_status = DoorStatus::DOOR_CLOSED;
-                GetVessel().TriggerRedrawArea(AID_INNERDOORINDICATOR);
-            }
-        } 
-        else  // door opening
-        {  
-            if (GetXR1().ilock_proc < 1.0)
-                GetXR1().ilock_proc = min (1.0, GetXR1().ilock_proc+da);
-            else
-            {
-                GetXR1().ilock_status = DoorStatus::DOOR_OPEN;
-                GetVessel().TriggerRedrawArea(AID_INNERDOORINDICATOR);
+                status = DoorStatus::DOOR_CLOSED;
+                if (m_doorIndicatorAreaID[i] >= 0)
+                    GetVessel().TriggerRedrawArea(m_doorIndicatorAreaID[i]);
             }
         }
-        GetXR1().SetXRAnimation(GetXR1().anim_ilock, GetXR1().ilock_proc);
-    }
-}
-
-//---------------------------------------------------------------------------
-// NOTE: This is not actually animation; however, it does pressurize / depressurize at a fixed speed like a door and so it handled here
-void AnimationPostStep::ManageChamberPressure(const double simt, const double simdt, const double mjd)
-{
-    if (GetXR1().chamber_status >= DoorStatus::DOOR_CLOSING)
-    {
-        double da = simdt * CHAMBER_OPERATING_SPEED;
-        if (GetXR1().chamber_status == DoorStatus::DOOR_CLOSING)
+        else    // door is opening or open
         {
-            if (GetXR1().chamber_proc > 0.0)
-                GetXR1().chamber_proc = max (0.0, GetXR1().chamber_proc-da);
-            else
-            {
-                GetXR1().chamber_status = DoorStatus::DOOR_CLOSED;
-                GetVessel().TriggerRedrawArea(AID_CHAMBERINDICATOR);
-            }
-        } 
-        else  // door opening
-        {  
-            if (GetXR1().chamber_proc < 1.0)
-                GetXR1().chamber_proc = min (1.0, GetXR1().chamber_proc+da);
+            if (proc < 1.0)
+                proc = min(1.0, proc + da);
             else
             {
-                GetXR1().chamber_status = DoorStatus::DOOR_OPEN;
-                GetVessel().TriggerRedrawArea(AID_CHAMBERINDICATOR);
+                status = DoorStatus::DOOR_OPEN;
+                if (m_doorOnOpened[i] != nullptr)
+                    (xr1.*m_doorOnOpened[i])(true);
+                if (m_doorIndicatorAreaID[i] >= 0)
+                    GetVessel().TriggerRedrawArea(m_doorIndicatorAreaID[i]);
             }
         }
-        // no animation to set
+
+        if (m_doorSetState[i] != nullptr)
+            (xr1.*m_doorSetState[i])(proc);
+        else if (m_doorAnim[i] != nullptr)
+            xr1.SetXRAnimation(*m_doorAnim[i], proc);
     }
 }
 
 //---------------------------------------------------------------------------
 
-void AnimationPostStep::AnimateHatch(const double simt, const double simdt, const double mjd)
+// Shut off the hatch decompression effects after they have vented for four seconds
+void AnimationPostStep::UpdateHatchDecompression(const double simt)
 {
-    if (GetXR1().hatch_status >= DoorStatus::DOOR_CLOSING)
-    {
-        double da = simdt * HATCH_OPERATING_SPEED;
-        if (GetXR1().hatch_status == DoorStatus::DOOR_CLOSING)
-        {
-            if (GetXR1().hatch_proc > 0.0)
-                GetXR1().hatch_proc = max(0.0, GetXR1().hatch_proc-da);
-            else
-            {
-                GetXR1().hatch_status = DoorStatus::DOOR_CLOSED;
-                GetVessel().TriggerRedrawArea(AID_HATCHINDICATOR);
-            }
-        } 
-        else
-        {
-            if (GetXR1().hatch_proc < 1.0)
-                GetXR1().hatch_proc = min(1.0, GetXR1().hatch_proc+da);
-            else
-            {
-                GetXR1().hatch_status = DoorStatus::DOOR_OPEN;
-                GetVessel().TriggerRedrawArea(AID_HATCHINDICATOR);
-            }
-        }
-        GetXR1().SetXRAnimation(GetXR1().anim_hatch, GetXR1().hatch_proc);
-    }
-
     if (GetXR1().hatch_vent && simt > GetXR1().hatch_vent_t + 4.0)    // vent for four seconds
     {
         GetXR1().CleanUpHatchDecompression();
@@ -248,195 +143,3 @@ void AnimationPostStep::AnimateHatch(const double simt, const double simdt, cons
         GetXR1().hatch_venting_lvl = nullptr;
     }
 }
-
-//---------------------------------------------------------------------------
-
-void AnimationPostStep::AnimateRadiator(const double simt, const double simdt, const double mjd)
-{
-    if (GetXR1().radiator_status >= DoorStatus::DOOR_CLOSING)
-    {
-        double da = simdt * RADIATOR_OPERATING_SPEED;
-        if (GetXR1().radiator_status == DoorStatus::DOOR_CLOSING)
-        { 
-            // retract radiator
-            if (GetXR1().radiator_proc > 0.0) 
-            {
-                GetXR1().radiator_proc = max (0.0, GetXR1().radiator_proc-da);
-            }
-            else                     
-            {
-                GetXR1().radiator_status = DoorStatus::DOOR_CLOSED;
-                GetVessel().TriggerRedrawArea(AID_RADIATORINDICATOR);
-            }
-        } 
-        else
-        {                               // deploy radiator
-            if (GetXR1().radiator_proc < 1.0)
-            {
-                GetXR1().radiator_proc = min (1.0, GetXR1().radiator_proc+da);
-            }
-            else
-            {
-                GetXR1().radiator_status = DoorStatus::DOOR_OPEN;
-                GetVessel().TriggerRedrawArea(AID_RADIATORINDICATOR);
-            }
-        }
-        GetXR1().SetXRAnimation(GetXR1().anim_radiator, GetXR1().radiator_proc);
-    }
-}
-
-//---------------------------------------------------------------------------
-
-void AnimationPostStep::AnimateRetroDoors (const double simt, const double simdt, const double mjd)
-{
-    if (GetXR1().rcover_status >= DoorStatus::DOOR_CLOSING)
-    {
-        double da = simdt * RCOVER_OPERATING_SPEED;
-        if (GetXR1().rcover_status == DoorStatus::DOOR_CLOSING)
-        {
-            if (GetXR1().rcover_proc > 0.0)
-                GetXR1().rcover_proc = max (0.0, GetXR1().rcover_proc-da);
-            else
-            {
-                GetXR1().rcover_status = DoorStatus::DOOR_CLOSED;
-                GetVessel().TriggerRedrawArea(AID_RETRODOORINDICATOR);
-            }
-        } 
-        else
-        {
-            if (GetXR1().rcover_proc < 1.0)
-                GetXR1().rcover_proc = min (1.0, GetXR1().rcover_proc+da);
-            else
-            {
-                GetXR1().rcover_status = DoorStatus::DOOR_OPEN;
-                GetXR1().EnableRetroThrusters (true);
-                GetVessel().TriggerRedrawArea(AID_RETRODOORINDICATOR);
-            }
-        }
-
-        GetXR1().SetXRAnimation(GetXR1().anim_rcover, GetXR1().rcover_proc);
-    }
-}
-
-//---------------------------------------------------------------------------
-
-void AnimationPostStep::AnimateHoverDoors(const double simt, const double simdt, const double mjd)
-{
-    if (GetXR1().hoverdoor_status >= DoorStatus::DOOR_CLOSING)
-    {
-        double da = simdt * HOVERDOOR_OPERATING_SPEED;
-        if (GetXR1().hoverdoor_status == DoorStatus::DOOR_CLOSING)
-        {
-            if (GetXR1().hoverdoor_proc > 0.0)
-                GetXR1().hoverdoor_proc = max (0.0, GetXR1().hoverdoor_proc-da);
-            else
-            {
-                GetXR1().hoverdoor_status = DoorStatus::DOOR_CLOSED;
-                GetVessel().TriggerRedrawArea(AID_HOVERDOORINDICATOR);
-            }
-        } 
-        else
-        {
-            if (GetXR1().hoverdoor_proc < 1.0)
-                GetXR1().hoverdoor_proc = min (1.0, GetXR1().hoverdoor_proc+da);
-            else
-            {
-                GetXR1().hoverdoor_status = DoorStatus::DOOR_OPEN;
-                GetXR1().EnableHoverEngines(true);
-                GetVessel().TriggerRedrawArea(AID_SCRAMDOORINDICATOR);
-            }
-        }
-
-        GetXR1().SetXRAnimation(GetXR1().anim_hoverdoor, GetXR1().hoverdoor_proc);
-    }
-}
-
-//---------------------------------------------------------------------------
-
-void AnimationPostStep::AnimateScramDoors(const double simt, const double simdt, const double mjd)
-{
-    if (GetXR1().scramdoor_status >= DoorStatus::DOOR_CLOSING)
-    {
-        double da = simdt * SCRAMDOOR_OPERATING_SPEED;
-        if (GetXR1().scramdoor_status == DoorStatus::DOOR_CLOSING)
-        {
-            if (GetXR1().scramdoor_proc > 0.0)
-                GetXR1().scramdoor_proc = max (0.0, GetXR1().scramdoor_proc-da);
-            else
-            {
-                GetXR1().scramdoor_status = DoorStatus::DOOR_CLOSED;
-                GetVessel().TriggerRedrawArea(AID_SCRAMDOORINDICATOR);
-            }
-        } 
-        else
-        {
-            if (GetXR1().scramdoor_proc < 1.0)
-                GetXR1().scramdoor_proc = min (1.0, GetXR1().scramdoor_proc+da);
-            else
-            {
-                GetXR1().scramdoor_status = DoorStatus::DOOR_OPEN;
-                GetXR1().EnableScramEngines(true);
-                GetVessel().TriggerRedrawArea(AID_SCRAMDOORINDICATOR);
-            }
-        }
-
-        GetXR1().SetXRAnimation(GetXR1().anim_scramdoor, GetXR1().scramdoor_proc);
-    }
-}
-
-//---------------------------------------------------------------------------
-
-void AnimationPostStep::AnimateGear(const double simt, const double simdt, const double mjd)
-{
-    if (GetXR1().gear_status >= DoorStatus::DOOR_CLOSING)
-    {
-        double da = simdt * GEAR_OPERATING_SPEED;
-        if (GetXR1().gear_status == DoorStatus::DOOR_CLOSING)
-        {
-            if (GetXR1().gear_proc > 0.0)
-                GetXR1().gear_proc = max (0.0, GetXR1().gear_proc-da);
-            else
-            {
-                GetXR1().gear_status = DoorStatus::DOOR_CLOSED;
-                GetVessel().TriggerRedrawArea(AID_GEARINDICATOR);
-            }
-        } 
-        else  // door opening
-        { 
-            if (GetXR1().gear_proc < 1.0)
-                GetXR1().gear_proc = min (1.0, GetXR1().gear_proc+da);
-            else
-            {
-                GetXR1().gear_status = DoorStatus::DOOR_OPEN;
-                GetVessel().TriggerRedrawArea(AID_GEARINDICATOR);
-            }
-        }
-        GetXR1().SetGearParameters(GetXR1().gear_proc);  // will set animation state as well
-    }
-}
-
-//---------------------------------------------------------------------------
-
-void AnimationPostStep::AnimateAirbrake(const double simt, const double simdt, const double mjd)
-{
-    if (GetXR1().brake_status >= DoorStatus::DOOR_CLOSING)
-    {
-        double da = simdt * AIRBRAKE_OPERATING_SPEED;
-        if (GetXR1().brake_status == DoorStatus::DOOR_CLOSING)  // retract brake
-        { 
-            if (GetXR1().brake_proc > 0.0) 
-                GetXR1().brake_proc = max (0.0, GetXR1().brake_proc-da);
-            else                  
-                GetXR1().brake_status = DoorStatus::DOOR_CLOSED;
-        } 
-        else   // deploy brake
-        {                            
-            if (GetXR1().brake_proc < 1.0) 
-                GetXR1().brake_proc = min (1.0, GetXR1().brake_proc+da);
-            else                  
-                GetXR1().brake_status = DoorStatus::DOOR_OPEN;
-        }
-
-        GetXR1().SetXRAnimation(GetXR1().anim_brake, GetXR1().brake_proc);
-    }
-}
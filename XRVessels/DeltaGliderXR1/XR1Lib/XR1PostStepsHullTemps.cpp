@@ -29,8 +29,29 @@
 
 SetHullTempsPostStep::SetHullTempsPostStep(DeltaGliderXR1& vessel) :
     XR1PrePostStep(vessel),
-    m_forceTempUpdate(true) // force update on first frame through to init hull temps
+    m_forceTempUpdate(true), // force update on first frame through to init hull temps
+    m_hLastHeatingMesh(nullptr), m_lastHeatingMeshVersion(0), m_isLastHeatingMeshVisibleValid(false), m_lastHeatingMeshVisible(false), m_lastHeatingAlphaLevel(-1),
+    m_visibilityUpdateCount(0), m_visibilitySkipCount(0), m_materialUpdateCount(0), m_materialSkipCount(0)
 {
+    DeltaGliderXR1 &xr1 = GetXR1();
+
+    //             temperature           heat source             heat scale
+    AddHullSurface(xr1.m_noseconeTemp,   HeatSource::Nosecone,   1.0);
+    AddHullSurface(xr1.m_leftWingTemp,   HeatSource::LeftWing,   0.75);          // nose gets 25% hotter than wings
+    AddHullSurface(xr1.m_rightWingTemp,  HeatSource::RightWing,  0.75);
+    AddHullSurface(xr1.m_cockpitTemp,    HeatSource::Cockpit,    0.73);          // nose gets 27% hotter than cockpit (max)
+    AddHullSurface(xr1.m_topHullTemp,    HeatSource::Cockpit,    0.73 * 0.80);   // top hull gets 80% of the heat that the cockpit does
+}
+
+// Add a hull surface to be heated and cooled each frame.
+// temp = vessel's temperature variable for this surface
+// heatSource = leading-edge heating pattern this surface follows
+// heatScale = fraction of the heat source's heat that reaches this surface
+void SetHullTempsPostStep::AddHullSurface(double &temp, const HeatSource heatSource, const double heatScale)
+{
+    m_surfaceTemp.push_back(&temp);
+    m_surfaceHeatSource.push_back(heatSource);
+    m_surfaceHeatScale.push_back(heatScale);
 }
 
 void SetHullTempsPostStep::clbkPrePostStep(const double simt, const double simdt, const double mjd)
@@ -146,6 +167,16 @@ void SetHullTempsPostStep::AddHeat(const double simdt)
             const double altitude = GetVessel().GetAltitude(ALTMODE_GROUND);
             const double aoa = GetVessel().GetAOA();
 
+            // the sine of each angle is used by more than one surface, so compute them once here
+            // Note: slip and AOA are in the range -PI to PI, so sin(fabs(angle)) == fabs(sin(angle))
+            const double sinSlip = sin(slipAngle);
+            const double sinAOA = sin(aoa);
+            const double sinAbsSlip = fabs(sinSlip);
+            const double sinAbsAOA = fabs(sinAOA);
+
+            // heat fraction for each heat source: index = HeatSource
+            double heatFrac[static_cast<int>(HeatSource::Count)];
+
             // NOSECONE
             // since we have TWO factors affecting the nosecone, cut each effect into pieces
 
@@ -156,75 +187,43 @@ void SetHullTempsPostStep::AddHeat(const double simdt)
             {
                 // the smaller the slip, the HIGHER the heat
                 // changing slip has 1/5 effect of sine angle change
-                noseconeSlipHeatFrac = 1.0 - (sin(fabs(slipAngle)) / 5 / 2);
+                noseconeSlipHeatFrac = 1.0 - (sinAbsSlip / 5 / 2);
 
                 // changing AOA has 1/3 effect of sine angle change
-                noseconeAOAHeatFrac = 1.0 - (sin(fabs(aoa)) / 3 / 2);
+                noseconeAOAHeatFrac = 1.0 - (sinAbsAOA / 3 / 2);
             }
             else   // going BACKWARDS
             {
                 // the smaller the slip, the LOWER the heat
-                noseconeSlipHeatFrac = (sin(fabs(slipAngle)) / 5 / 2);
-                noseconeAOAHeatFrac = (sin(fabs(aoa)) / 3 / 2);
+                noseconeSlipHeatFrac = (sinAbsSlip / 5 / 2);
+                noseconeAOAHeatFrac = (sinAbsAOA / 3 / 2);
             }
 
             // no need to check for fractions > 1.0 here since the sine of a positive number is always positive
             // now combine both fractions to get the overall fraction
-            double noseconeHeatFrac = noseconeSlipHeatFrac * noseconeAOAHeatFrac;
+            heatFrac[static_cast<int>(HeatSource::Nosecone)] = noseconeSlipHeatFrac * noseconeAOAHeatFrac;
 
             // WINGS
             // no need to reduce angles here; if slip > 90 degrees left or 
             // to reduce heat for right wing, slip must be POSITIVE, meaning positive slip == right turn
-            // Minimum heat is is 10% of total wing heat.
-            double rightWingHeatFrac = (1.0 - (sin(slipAngle) * 0.9));
-
             // to reduce heat for left wing, slip must be NEGATIVE, meaning negative slip == left turn
             // Minimum heat is is 10% of total wing heat.
-            double leftWingHeatFrac = (1.0 - (sin(-slipAngle) * 0.9));
-
-            // heating factor can never exceed total heat on the leading edge, so cap it at 1.0
-            if (leftWingHeatFrac > 1.0)
-                leftWingHeatFrac = 1.0;
-
-            if (rightWingHeatFrac > 1.0)
-                rightWingHeatFrac = 1.0;
+            // Heating factor can never exceed total heat on the leading edge, so cap it at 1.0.
+            heatFrac[static_cast<int>(HeatSource::RightWing)] = min(1.0, (1.0 - (sinSlip * 0.9)));
+            heatFrac[static_cast<int>(HeatSource::LeftWing)] = min(1.0, (1.0 + (sinSlip * 0.9)));
 
             // COCKPIT
-            double cockpitHeatFrac = (1.0 - sin(aoa));
-
             // cap it at 1.20 (in case the pilot pitches down), in which case the cockpit can get as hot as the nose
-            if (cockpitHeatFrac > 1.20)
-                cockpitHeatFrac = 1.20;
+            heatFrac[static_cast<int>(HeatSource::Cockpit)] = min(1.20, (1.0 - sinAOA));
 
-            // NOSECONE
-            // NOTE: this variable is reused for each surface
-            double newTemp = extTemp + (noseconeHeatFrac * degreesK);
-
-            // Don't ever LOWER the nosecone temp in the "add heat" phase here
-            if (newTemp > GetXR1().m_noseconeTemp)
-                GetXR1().m_noseconeTemp = newTemp;
-
-            // LEFT WING
-            newTemp = extTemp + ((leftWingHeatFrac * degreesK) * 0.75);  // nose gets 25% hotter than wings
-            if (newTemp > GetXR1().m_leftWingTemp)
-                GetXR1().m_leftWingTemp = newTemp;
-
-            // RIGHT WING
-            newTemp = extTemp + ((rightWingHeatFrac * degreesK) * 0.75);
-            if (newTemp > GetXR1().m_rightWingTemp)
-                GetXR1().m_rightWingTemp = newTemp;
-
-            // COCKPIT
-            double cockpitDeltaTemp = (cockpitHeatFrac * degreesK) * .73;  // nose gets 27% hotter than cockpit (max)
-            newTemp = extTemp + cockpitDeltaTemp;
-            if (newTemp > GetXR1().m_cockpitTemp)
-                GetXR1().m_cockpitTemp = newTemp;
-
-            // TOP HULL
-            // top hull gets 80% of the heat that the cockpit does
-            newTemp = extTemp + (cockpitDeltaTemp * 0.80);
-            if (newTemp > GetXR1().m_topHullTemp)
-                GetXR1().m_topHullTemp = newTemp;
+            // now heat each surface; don't ever LOWER a surface's temp in the "add heat" phase here
+            const int surfaceCount = static_cast<int>(m_surfaceTemp.size());
+            for (int i = 0; i < surfaceCount; i++)
+            {
+                const double newTemp = extTemp + (heatFrac[static_cast<int>(m_surfaceHeatSource[i])] * degreesK * m_surfaceHeatScale[i]);
+                if (newTemp > *m_surfaceTemp[i])
+                    *m_surfaceTemp[i] = newTemp;
+            }
         }
     }
     m_forceTempUpdate = false;      // reset
@@ -233,18 +232,16 @@ void SetHullTempsPostStep::AddHeat(const double simdt)
 void SetHullTempsPostStep::RemoveHeat(const double simdt)
 {
     // heat dissipation rates are the same for each surface
-    RemoveSurfaceHeat(simdt, GetXR1().m_noseconeTemp);
-    RemoveSurfaceHeat(simdt, GetXR1().m_leftWingTemp);
-    RemoveSurfaceHeat(simdt, GetXR1().m_rightWingTemp);
-    RemoveSurfaceHeat(simdt, GetXR1().m_cockpitTemp);
-    RemoveSurfaceHeat(simdt, GetXR1().m_topHullTemp);
+    const double extTemp = GetXR1().GetExternalTemperature();
+    for (double *pTemp : m_surfaceTemp)
+        RemoveSurfaceHeat(simdt, extTemp, *pTemp);
 }
 
 // remove heat from a single surface
+// extTemp = external temperature
 // temp = temperature of surface
-void SetHullTempsPostStep::RemoveSurfaceHeat(const double simdt, double& temp)
+void SetHullTempsPostStep::RemoveSurfaceHeat(const double simdt, const double extTemp, double& temp)
 {
-    const double extTemp = GetXR1().GetExternalTemperature();
     const double delta = fabs(temp - extTemp);
 
     // Each surface drops 2% or .1 degree of its heat ABOVE AMBIENT per second, whichever is greater
@@ -258,13 +255,30 @@ void SetHullTempsPostStep::RemoveSurfaceHeat(const double simdt, double& temp)
 }
 
 // update the transparency of the hull heating mesh, if any
+// The mesh visibility and material are only sent to the graphics client when they actually change.
 void SetHullTempsPostStep::UpdateHullHeatingMesh(const double simdt)
 {
     if (!GetXR1().heatingmesh)
-        return;     // no hull heating mesh
+    {
+        // no hull heating mesh, or our visual was destroyed: whatever mesh we get next starts out with its default state
+        m_hLastHeatingMesh = nullptr;
+        m_isLastHeatingMeshVisibleValid = false;
+        m_lastHeatingAlphaLevel = -1;
+        return;
+    }
 
     // DEBUG: heating mesh testing: GetXR1().m_noseconeTemp = GetXR1().m_tweakedInternalValue;
 
+    // A new mesh instance is created each time our visual is recreated, so forget what we sent to the old one.
+    // The new instance may have the same handle as the old one, so we check the version as well.
+    if ((GetXR1().heatingmesh != m_hLastHeatingMesh) || (GetXR1().m_heatingMeshVersion != m_lastHeatingMeshVersion))
+    {
+        m_hLastHeatingMesh = GetXR1().heatingmesh;
+        m_lastHeatingMeshVersion = GetXR1().m_heatingMeshVersion;
+        m_isLastHeatingMeshVisibleValid = false;
+        m_lastHeatingAlphaLevel = -1;
+    }
+
     // We check temperature of the nosecone only; set the limits at which the mesh becomes barely visible
     // to where it is at its maximum opacity (maxHeatingAlpha).
     const double minVisibilityTemp = GetXR1().m_hullTemperatureLimits.noseCone * 0.387;  // coincides with Orbiter visual plasma
@@ -274,8 +288,18 @@ void SetHullTempsPostStep::UpdateHullHeatingMesh(const double simdt)
     // actually be *visible* because the Orbiter core applies the alpha setting to *all*
     // transparent meshes in the sim, including the Sun!  This makes the sun disappear.
     const bool bHeatingMeshVisible = (GetXR1().m_noseconeTemp >= minVisibilityTemp);
-    GetXR1().SetMeshGroupVisible(GetXR1().heatingmesh, GetHeatingMeshGroupIndex(), bHeatingMeshVisible);  // show or hide the group
-    oapiSetMeshProperty(GetXR1().heatingmesh, MESHPROPERTY_MODULATEMATALPHA, (DWORD)bHeatingMeshVisible); // use material alpha w/texture alpha
+    if (!m_isLastHeatingMeshVisibleValid || (bHeatingMeshVisible != m_lastHeatingMeshVisible))
+    {
+        GetXR1().SetMeshGroupVisible(GetXR1().heatingmesh, GetHeatingMeshGroupIndex(), bHeatingMeshVisible);  // show or hide the group
+        oapiSetMeshProperty(GetXR1().heatingmesh, MESHPROPERTY_MODULATEMATALPHA, (DWORD)bHeatingMeshVisible); // use material alpha w/texture alpha
+        m_lastHeatingMeshVisible = bHeatingMeshVisible;
+        m_isLastHeatingMeshVisibleValid = true;
+        m_visibilityUpdateCount++;
+    }
+    else
+    {
+        m_visibilitySkipCount++;
+    }
 
     if (bHeatingMeshVisible)
     {
@@ -285,30 +309,52 @@ void SetHullTempsPostStep::UpdateHullHeatingMesh(const double simdt)
         if (alphaFrac > 1.0)
             alphaFrac = 1.0;    // keep in range
 
-        // now get the alpha to be applied
-        // min heating alpha is 0.0
-        // BETA-1 ORG: const double maxHeatingAlpha = 0.475;
-        const double maxHeatingAlpha = 1.0;  // new heating mesh is 4-bit alpha
-        const float heatingMeshAlpha = static_cast<float>(alphaFrac * maxHeatingAlpha);
-
-        // read the original material from the *global* mesh and clone it, since we cannot read material from the active ship's mesh in Orbiter_ng
-        const MATERIAL* pSrcHeatingMaterial = oapiMeshMaterial(GetXR1().heatingmesh_tpl, GetHeatingMeshGroupIndex());
-        MATERIAL clonedMaterial;
-        memcpy(&clonedMaterial, pSrcHeatingMaterial, sizeof(MATERIAL));  // make working copy
-
-        // now set the new alpha in the working copy
-        clonedMaterial.diffuse.a = heatingMeshAlpha;
-        clonedMaterial.ambient.a = heatingMeshAlpha;
-        clonedMaterial.specular.a = heatingMeshAlpha;
-        clonedMaterial.emissive.a = heatingMeshAlpha;
-
-        // apply the modified material to the heating mesh
-        oapiSetMaterial(GetXR1().heatingmesh, GetHeatingMeshGroupIndex(), &clonedMaterial);
-
-        // DEBUG: sprintf(oapiDebugString(), "NoseconeTemp: %.3lf heatingMeshAlpha=%f", GetXR1().m_noseconeTemp, heatingMeshAlpha);
+        // round to the nearest alpha level the mesh can actually display; there is no point in sending a new material to the graphics client until that changes
+        const int alphaLevel = static_cast<int>((alphaFrac * MAX_HEATING_ALPHA_LEVEL) + 0.5);
+        if (alphaLevel != m_lastHeatingAlphaLevel)
+        {
+            // now get the alpha to be applied
+            // min heating alpha is 0.0
+            // BETA-1 ORG: const double maxHeatingAlpha = 0.475;
+            const double maxHeatingAlpha = 1.0;  // new heating mesh is 4-bit alpha
+            const float heatingMeshAlpha = static_cast<float>((static_cast<double>(alphaLevel) / MAX_HEATING_ALPHA_LEVEL) * maxHeatingAlpha);
+
+            // read the original material from the *global* mesh and clone it, since we cannot read material from the active ship's mesh in Orbiter_ng
+            const MATERIAL* pSrcHeatingMaterial = oapiMeshMaterial(GetXR1().heatingmesh_tpl, GetHeatingMeshGroupIndex());
+            MATERIAL clonedMaterial;
+            memcpy(&clonedMaterial, pSrcHeatingMaterial, sizeof(MATERIAL));  // make working copy
+
+            // now set the new alpha in the working copy
+            clonedMaterial.diffuse.a = heatingMeshAlpha;
+            clonedMaterial.ambient.a = heatingMeshAlpha;
+            clonedMaterial.specular.a = heatingMeshAlpha;
+            clonedMaterial.emissive.a = heatingMeshAlpha;
+
+            // apply the modified material to the heating mesh
+            oapiSetMaterial(GetXR1().heatingmesh, GetHeatingMeshGroupIndex(), &clonedMaterial);
+            m_lastHeatingAlphaLevel = alphaLevel;
+            m_materialUpdateCount++;
+
+            // DEBUG: sprintf(oapiDebugString(), "NoseconeTemp: %.3lf heatingMeshAlpha=%f", GetXR1().m_noseconeTemp, heatingMeshAlpha);
+        }
+        else
+        {
+            m_materialSkipCount++;
+        }
     }
     else
     {
         // DEBUG: sprintf(oapiDebugString(), "NoseconeTemp: %.3lf : Heating mesh invisible", GetXR1().m_noseconeTemp);
     }
 }
+
+// Report how many heating mesh updates were sent to the graphics client vs. skipped because nothing changed
+bool SetHullTempsPostStep::GetProfilerDetails(char *pBuffer, const int bufferLength) const
+{
+    if ((m_visibilityUpdateCount + m_visibilitySkipCount) == 0)
+        return false;   // vessel has no heating mesh, or it was never visible
+
+    sprintf_s(pBuffer, bufferLength, "heating mesh: visibility updates=%u skipped=%u, material updates=%u skipped=%u",
+        m_visibilityUpdateCount, m_visibilitySkipCount, m_materialUpdateCount, m_materialSkipCount);
+    return true;
+}
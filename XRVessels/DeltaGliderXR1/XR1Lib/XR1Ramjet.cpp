@@ -35,45 +35,52 @@
 XR1Ramjet::XR1Ramjet (DeltaGliderXR1 *_vessel): 
     vessel(_vessel)
 {
-	nthdef = 0;    // no thrusters associated yet
-
     for (int i=0; i < 2; i++)   // enable engines @ 100%
         m_integrity[i] = 1.0;
+
+    m_atmCache.pAtm = nullptr;  // not computed yet
 }
 
 // destructor
 XR1Ramjet::~XR1Ramjet ()
 {
-	if (nthdef) 
-    {  
-        // delete list of thruster definitions
-		for (UINT i = 0; i < nthdef; i++)
-			delete thdef[i];
-		delete []thdef;
-	}
 }
 
 // add new thruster definition to list
 void XR1Ramjet::AddThrusterDefinition (THRUSTER_HANDLE th,
 	double Qr, double Ai, double Tb_max, double dmf_max)
 {
-	THDEF *thd   = new THDEF;
-	thd->th      = th;
-	thd->Qr      = Qr;
-	thd->Ai      = Ai;
-	thd->Tb_max  = Tb_max;
-	thd->dmf_max = dmf_max;
-	thd->dmf     = 0.0;
-	thd->F       = 0.0;
-	for (int i = 0; i < 3; i++) thd->T[i] = 0.0;
-
-	THDEF **tmp = new THDEF*[nthdef+1];
-	if (nthdef) {
-		memcpy (tmp, thdef, nthdef * sizeof(THDEF*));
-		delete []thdef;
-	}
-	thdef = tmp;
-	thdef[nthdef++] = thd;
+	m_th.push_back(th);
+	m_Qr.push_back(Qr);
+	m_Ai.push_back(Ai);
+	m_Tb_max.push_back(Tb_max);
+	m_dmf_max.push_back(dmf_max);
+
+	m_dmf.push_back(0.0);
+	m_F.push_back(0.0);
+	for (int i = 0; i < 3; i++) m_T[i].push_back(0.0);
+	m_pd.push_back(0.0);
+	m_lvl.push_back(0.0);
+	m_QrOverCp.push_back(0.0);
+
+	m_atmCache.pAtm = nullptr;  // force m_QrOverCp to be recomputed for the new thruster
+}
+
+// Recompute the terms that depend only on the atmosphere's gas constants if the atmosphere changed since the last call
+void XR1Ramjet::UpdateAtmCache(const ATMCONST *pAtm) const
+{
+    if (pAtm == m_atmCache.pAtm)
+        return;     // still valid
+
+    m_atmCache.pAtm = pAtm;
+    m_atmCache.cp = pAtm->gamma * pAtm->R / (pAtm->gamma-1.0);
+    m_atmCache.gammaR = pAtm->gamma * pAtm->R;
+    m_atmCache.diffuserExp = pAtm->gamma/(pAtm->gamma-1.0);
+    m_atmCache.exhaustExp = (pAtm->gamma-1.0)/pAtm->gamma;
+
+    const UINT thrusterCount = GetThrusterCount();
+    for (UINT i = 0; i < thrusterCount; i++)
+        m_QrOverCp[i] = m_Qr[i] / m_atmCache.cp;
 }
 
 // calculate current thrust force for all engines
@@ -81,22 +88,24 @@ void XR1Ramjet::Thrust (double *F) const
 {
 	const OBJHANDLE hBody = vessel->GetAtmRef();
 	const ATMCONST *atm = (hBody ? oapiGetPlanetAtmConstants (hBody) : 0);
+	const UINT thrusterCount = GetThrusterCount();
 
 	if (atm)   // atmospheric parameters available
     { 
-		double M, Fs, T0, Td, Tb, Tb0, Te, p0, pd, D, rho, cp, v0, ve, tr, lvl, dma, dmf, precov, dmafac;
+		double M, Fs, T0, Td, Tb, Tb0, Te, p0, pd, D, cp, v0, ve, tr, lvl, dma, dmf, precov, dmafac;
 		// ORG: const double dma_scale = 2.7e-4;
         const double dma_scale = SCRAM_DMA_SCALE;  // {DEB} tweaked for mach 17 (value is 1/2 original)
 
+        UpdateAtmCache(atm);
+
 		M   = vessel->GetMachNumber();                     // Mach number
 		T0  = vessel->GetExternalTemperature();                        // freestream temperature
 		p0  = vessel->GetAtmPressure();                    // freestream pressure
-		rho = vessel->GetAtmDensity();                     // freestream density
-		cp  = atm->gamma * atm->R / (atm->gamma-1.0);      // specific heat (pressure)
-		v0  = M * sqrt (atm->gamma * atm->R * T0);         // freestream velocity
+		cp  = m_atmCache.cp;                               // specific heat (pressure)
+		v0  = M * sqrt (m_atmCache.gammaR * T0);           // freestream velocity
 		tr  = (1.0 + 0.5*(atm->gamma-1.0) * M*M);          // temperature ratio
 		Td  = T0 * tr;                                     // diffuser temperature
-		pd  = p0 * pow (Td/T0, atm->gamma/(atm->gamma-1.0)) * GetXR1().scramdoor_proc; // diffuser pressure; will be ZERO if SCRAM doors closed
+		pd  = p0 * pow (Td/T0, m_atmCache.diffuserExp) * GetXR1().scramdoor_proc; // diffuser pressure; will be ZERO if SCRAM doors closed
 
         // {DEB} modified this for high-altitude flight: new limit is mach 17 (doubled)
 		// ORG: precov = max (0.0, 1.0 - (0.075*pow(max(M,1.0)-1.0, 1.35)) ); // pressure recovery
@@ -106,25 +115,32 @@ void XR1Ramjet::Thrust (double *F) const
 
         dmafac = dma_scale*precov*pd;   // will be ZERO if SCRAM doors closed
 
+        // exhaust temperature = burner temperature * this ratio, which is the same for all engines
+        const double exhaustTempRatio = ((pd > 0) ? pow (p0/pd, m_atmCache.exhaustExp) : 0);
+
         // DEBUG: sprintf(oapiDebugString(), "Td=%lf, precov=%lf, dmafac=%lf, pd=%lf" , Td, precov, dmafac, pd);
 
-		for (UINT i = 0; i < nthdef; i++) 
-        {
-			Tb0 = thdef[i]->Tb_max;                        // max burner temperature
+        // gather the throttle levels up front so that the engine loop below only works on our own arrays
+		for (UINT i = 0; i < thrusterCount; i++) 
+            m_lvl[i] = vessel->GetThrusterLevel(m_th[i]);
 
-            lvl  = vessel->GetThrusterLevel(thdef[i]->th); // throttle level
+		for (UINT i = 0; i < thrusterCount; i++) 
+        {
+			Tb0 = m_Tb_max[i];                             // max burner temperature
+            lvl = m_lvl[i];                                // throttle level
 
             // NOTE: engine temp is checked in DMG file
 
-            if ((pd > 0) & (Tb0 > Td))    // any diffuser pressure AND are we within operational range?
+            bool isRunning = ((pd > 0) & (Tb0 > Td));      // any diffuser pressure AND are we within operational range?
+            if (isRunning)
             {                                
-				D    = (Tb0-Td) / (thdef[i]->Qr/cp - Tb0); // max fuel-to-air ratio (what if negative?)
-                //dma  = rho * v0 * thdef[i]->Ai;          // air mass flow rate (DEB: Martin commented this out)
-                dma = dmafac * thdef[i]->Ai;               // air mass flow rate [kg/s]
+				D    = (Tb0-Td) / (m_QrOverCp[i] - Tb0);   // max fuel-to-air ratio (what if negative?)
+                //dma  = rho * v0 * m_Ai[i];               // air mass flow rate (DEB: Martin commented this out)
+                dma = dmafac * m_Ai[i];                    // air mass flow rate [kg/s]
 
                 // {DEB} reduce effective level based on dmf_max limit
                 // FORMULA: throttleFrac = D * dma / max_dmf, where x = throttle fraction limit (0...n)
-                double throttleFrac = D * dma / thdef[i]->dmf_max;
+                double throttleFrac = D * dma / m_dmf_max[i];
                 
                 // if throttleFrac > 1.0, it means that we need to reduce the throttle sensitivity by that fraction; i.e., reduce the effective throttle setting
                 if (throttleFrac > 1.0)
@@ -133,61 +149,55 @@ void XR1Ramjet::Thrust (double *F) const
 				D   *= lvl;                                // actual fuel-to-air ratio
 				dmf  = D * dma;                            // fuel mass flow rate
                 
-                // debug: if (i == 0) sprintf(oapiDebugString(), "throttleFrac=%lf, D=%lf, dma=%lf, dmf=%lf, dmf_max=%lf", throttleFrac, D, dma, dmf, thdef[i]->dmf_max);
+                // debug: if (i == 0) sprintf(oapiDebugString(), "throttleFrac=%lf, D=%lf, dma=%lf, dmf=%lf, dmf_max=%lf", throttleFrac, D, dma, dmf, m_dmf_max[i]);
 
-				if (dmf > thdef[i]->dmf_max)               // max fuel rate exceeded
+				if (dmf > m_dmf_max[i])                    // max fuel rate exceeded
                 {             
-					dmf = thdef[i]->dmf_max;
+					dmf = m_dmf_max[i];
 					D = dmf/dma;
 				}
-				Tb   = (D*thdef[i]->Qr/cp + Td) / (1.0+D); // actual burner temperature
-				Te   = Tb * pow (p0/pd, (atm->gamma-1.0)/atm->gamma); // exhaust temperature
+				Tb   = (D*m_Qr[i]/cp + Td) / (1.0+D);      // actual burner temperature
+				Te   = Tb * exhaustTempRatio;              // exhaust temperature
                 
                 // bugfix: if exhaust temperature > burner temperature, we cannot continue
                 if (Te > Tb)
-                {
-                    /* DEBUG ONLY
-                    static double count = 0;
-                    count++;
-                    sprintf(oapiDebugString(), "Te > Tb count: %lf", count);
-                    */
-                    goto engines_off;
-                }
+                    isRunning = false;
+            }
 
+            if (isRunning)
+            {
 				ve   = sqrt (2.0*cp*(Tb-Te));              // exhaust velocity
 			    Fs  = (1.0+D)*ve - v0;                     // specific thrust
 
-				thdef[i]->F = F[i] = max(0.0, Fs*dma * m_integrity[i]);    // thrust force * integrity fraction (0...1)
+				m_F[i] = F[i] = max(0.0, Fs*dma * m_integrity[i]);    // thrust force * integrity fraction (0...1)
 
                 // NEW CHECK: if no thrust, fuel flow is also zero
-                if (thdef[i]->F == 0.0)
+                if (m_F[i] == 0.0)
                     dmf = 0;    // no flow
 
-				thdef[i]->dmf = dmf;
-				thdef[i]->T[1] = Tb;
-				thdef[i]->T[2] = Te;
-
+				m_dmf[i] = dmf;
+				m_T[1][i] = Tb;
+				m_T[2][i] = Te;
 			} 
             else   // overheating or SCRAM doors are closed!
             {                                       
-engines_off:
-				thdef[i]->F = F[i] = 0.0;
-				thdef[i]->dmf = 0.0;
-				thdef[i]->T[1] = thdef[i]->T[2] = Td;
-
+				m_F[i] = F[i] = 0.0;
+				m_dmf[i] = 0.0;
+				m_T[1][i] = m_T[2][i] = Td;
 			}
-			thdef[i]->T[0] = Td;    // save diffuser temperature; may be very high, but we message the internal temp here for heat and display checks in the "Temp" method below
-            thdef[i]->pd = pd;      // save diffuser pressure; will be ZERO if doors closed or out of atmosphere
+			m_T[0][i] = Td;     // save diffuser temperature; may be very high, but we message the internal temp here for heat and display checks in the "Temp" method below
+            m_pd[i] = pd;       // save diffuser pressure; will be ZERO if doors closed or out of atmosphere
 		}
 	} 
     else  // no atmospheric parameters or engines disabled
     {   
-		for (UINT i = 0; i < nthdef; i++)
+        const double extTemp = vessel->GetExternalTemperature();
+		for (UINT i = 0; i < thrusterCount; i++)
         {
-            thdef[i]->dmf = 0.0;
-			thdef[i]->F = F[i] = 0.0;
-            thdef[i]->T[0] = thdef[i]->T[1] = thdef[i]->T[0] = vessel->GetExternalTemperature();  // set to external temperature
-            thdef[i]->pd = 0;       // zero pressure
+            m_dmf[i] = 0.0;
+			m_F[i] = F[i] = 0.0;
+            m_T[0][i] = m_T[1][i] = m_T[2][i] = extTemp;  // set to external temperature
+            m_pd[i] = 0;        // zero pressure
 		}
 	}
 }
@@ -195,7 +205,7 @@ engines_off:
 double XR1Ramjet::TSFC (UINT idx) const
 {
 	const double eps = 1e-5;
-	return thdef[idx]->dmf/(thdef[idx]->F+eps);
+	return m_dmf[idx]/(m_F[idx]+eps);
 }
 
 // returns "visual" temperature used for display purposes and for heat checks
@@ -211,7 +221,7 @@ double XR1Ramjet::Temp(UINT idx, UINT which) const
     if (vessel->scramdoor_status == DoorStatus::DOOR_CLOSED)
         return freestreamTemp;
 
-    double t = thdef[idx]->T[which] / SCRAM_COOLING; // adjusted for the XR1
+    double t = m_T[which][idx] / SCRAM_COOLING; // adjusted for the XR1
 
     // Modify visual diffuser temperature based on diffuser pressure; this allows the temperature to rise gradually as the ship reenters the atmosphere,
     // giving the pilot time to close the SCRAM doors.
@@ -223,11 +233,11 @@ double XR1Ramjet::Temp(UINT idx, UINT which) const
     }
 
     // NOTE: OK if pd is zero (or even negative, although that should never happen) 
-    const double tdFrac = thdef[idx]->pd / (76923 * mach);  // once diffuser pressure reaches 2.0 million @ mach 26, temperature reaches full
+    const double tdFrac = m_pd[idx] / (76923 * mach);  // once diffuser pressure reaches 2.0 million @ mach 26, temperature reaches full
     if (tdFrac < 1.0)
         t *= tdFrac;   // reduce temperature
     
-    // DEBUG: sprintf(oapiDebugString(), "Td=%lf, tdFrac=%lf, pd=%lf, mach=%lf" , t, tdFrac, thdef[idx]->pd, mach);
+    // DEBUG: sprintf(oapiDebugString(), "Td=%lf, tdFrac=%lf, pd=%lf, mach=%lf" , t, tdFrac, m_pd[idx], mach);
 
     // if t < freestream temp, return the freestream temp
     if (t < freestreamTemp)
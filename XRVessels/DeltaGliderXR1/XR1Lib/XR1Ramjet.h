@@ -41,6 +41,10 @@
 
 #include "XR1Globals.h"
 
+#include <vector>
+
+using namespace std;
+
 class DeltaGliderXR1;
 
 class XR1Ramjet 
@@ -74,11 +78,11 @@ public:
 	// calculates the thrust generated by each thruster
 	// and returns the force value in the supplied list F
 	// On input, F must point to an array of at least the same
-	// length as the number of thruster definitions (nthdef)
+	// length as the number of thruster definitions
 	void Thrust (double *F) const;
 
 	// returns current fuel mass flow of thruster idx
-	inline double DMF (UINT idx) const { return thdef[idx]->dmf; }
+	inline double DMF (UINT idx) const { return m_dmf[idx]; }
 
 	// returns diffuser, combustion or exhaust temperature [K] of thruster idx
 	// {DEB} these are ADJUSTED temperatures for the XR1
@@ -93,28 +97,15 @@ public:
     // Also, we are getting some weirdness here where F is sometimes -0.0000...  Therefore we, check for that here.
     double GetMostRecentThrust(int index) const 
     { 
-        double retVal = thdef[index]->F;
+        double retVal = m_F[index];
         if (retVal <= 0.0) 
             retVal = 0;
 
         return retVal;
     }
 
-    // made public for the XR1
-    struct THDEF        // list of XR1Ramjet thrusters
-    {             
-		THRUSTER_HANDLE th;    //   thruster handle                -+
-		double Qr;             //   fuel heating parameter [J/kg]   | static
-		double Ai;             //   air intake cross section [m^2]  | parameters
-		double Tb_max;         //   max. burner temperature [K]     |
-		double dmf_max;        //   max. fuel flow rate [kg/s]     -+
-
-		double dmf;            //   current fuel mass rate [kg/s]  -+ dynamic
-		double F;              //   current thrust [N]              | parameters
-		double T[3];           //   temperatures                   -+ 0=diffuser, 1=burner, 2=exhaust
-        double pd;             //   diffuser pressure
-	} **thdef;
-	UINT nthdef;               // number of XR1Ramjet thrusters
+    THRUSTER_HANDLE GetThrusterHandle(UINT idx) const { return m_th[idx]; }
+    UINT GetThrusterCount() const { return static_cast<UINT>(m_th.size()); }
 
     // disable/enable an engine
     void SetEngineIntegrity(int engine, double integ) { m_integrity[engine] = integ; }
@@ -123,7 +114,37 @@ public:
 protected:
     DeltaGliderXR1 &GetXR1() const { return *vessel; }
 
+    // Terms that depend only on the atmosphere's gas constants; these are recomputed only when the vessel's atmosphere reference changes.
+    struct AtmCache
+    {
+        const ATMCONST *pAtm;   // atmosphere these terms were computed for; nullptr = not computed yet
+        double cp;              // specific heat (pressure)
+        double gammaR;          // gamma * R
+        double diffuserExp;     // gamma / (gamma-1): diffuser pressure exponent
+        double exhaustExp;      // (gamma-1) / gamma: exhaust temperature exponent
+    };
+
+    void UpdateAtmCache(const ATMCONST *pAtm) const;
+
 private:
 	DeltaGliderXR1 *vessel;        // vessel pointer
     double m_integrity[2];         // 0...1
+
+    // thruster definitions stored as parallel arrays: index = thruster index
+    // static parameters
+    vector<THRUSTER_HANDLE> m_th;  // thruster handle
+    vector<double> m_Qr;           // fuel heating parameter [J/kg]
+    vector<double> m_Ai;           // air intake cross section [m^2]
+    vector<double> m_Tb_max;       // max. burner temperature [K]
+    vector<double> m_dmf_max;      // max. fuel flow rate [kg/s]
+
+    // dynamic parameters; these are updated by Thrust, which is logically const
+    mutable vector<double> m_dmf;      // current fuel mass rate [kg/s]
+    mutable vector<double> m_F;        // current thrust [N]
+    mutable vector<double> m_T[3];     // temperatures: 0=diffuser, 1=burner, 2=exhaust
+    mutable vector<double> m_pd;       // diffuser pressure
+    mutable vector<double> m_lvl;      // throttle levels gathered at the start of each Thrust call
+    mutable vector<double> m_QrOverCp; // Qr / cp for the current atmosphere
+
+    mutable AtmCache m_atmCache;
 };
@@ -190,7 +190,7 @@ void SecondaryHUDArea::RenderCell(HDC hDC, SecondaryHUDMode& secondaryHUD, const
         return;     // cell is empty!
 
     // Populate the value and valueText in this cell from our parent vessel
-    PopulateCell(cell);
+    PopulateCell(cell, m_cellCache[row][column]);
 
     const int xOffset = 34;             // # columns from left to render ":" in "Alt:"; splits each column between label and value
     const int xCenter = m_width / 2;    // horizontal center of HUD
@@ -212,7 +212,8 @@ void SecondaryHUDArea::RenderCell(HDC hDC, SecondaryHUDMode& secondaryHUD, const
 }
 
 // Populate value and valueStr in the supplied cell
-void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
+// cache = formatting cache for this cell's position on the HUD
+void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell, CellCache& cache)
 {
     const FieldID fieldID = cell.pField->id;
     const Units units = cell.units;
@@ -228,11 +229,11 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
         {
             // altitude will never be negative here
             if (value >= 1e7)   // >= 10 million meters (10,000 km)?
-                sprintf(valueStr, "%.2lf mm", (value / 1e6));
+                FormatCellValue(cache, valueStr, (value / 1e6), 2, " mm");
             else if (value >= 3e4)   // >= 30 km?
-                sprintf(valueStr, "%.3lf km", (value / 1e3));
+                FormatCellValue(cache, valueStr, (value / 1e3), 3, " km");
             else
-                sprintf(valueStr, "%.2lf m", value);
+                FormatCellValue(cache, valueStr, value, 2, " m");
         }
         else    // imperial
         {
@@ -240,11 +241,11 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
             // handle large mile distances here
             const double distInMiles = (value / 5280);
             if (fabs(distInMiles) >= 1e6)   // >= 1 million miles?
-                sprintf(valueStr, "%.3lf mmi", (distInMiles / 1e6));  // do not clip
+                FormatCellValue(cache, valueStr, (distInMiles / 1e6), 3, " mmi");  // do not clip
             else if (value > 407e3)  // > 407000 ft?
-                sprintf(valueStr, "%.2lf mi", distInMiles);
+                FormatCellValue(cache, valueStr, distInMiles, 2, " mi");
             else
-                sprintf(valueStr, "%.2lf ft", value);
+                FormatCellValue(cache, valueStr, value, 2, " ft");
         }
         break;
 
@@ -253,17 +254,17 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
         // velocity will never be negative 
         if (units == Units::u_met) // metric
         {
-            sprintf(valueStr, "%.1lf m/s", value);
+            FormatCellValue(cache, valueStr, value, 1, " m/s");
         }
         else if (units == Units::u_imp)   // imperial
         {
             value = MpsToMph(value);
-            sprintf(valueStr, "%.1lf mph", value);
+            FormatCellValue(cache, valueStr, value, 1, " mph");
         }
         else if (units == Units::u_M)
         {
             value = GetXR1().GetMachNumber();
-            sprintf(valueStr, "%.3lf Mach", value);  // cap @ 11 characters here b/c of clipping issue with "mach"
+            FormatCellValue(cache, valueStr, value, 3, " Mach");  // cap @ 11 characters here b/c of clipping issue with "mach"
         }
         break;
 
@@ -273,12 +274,12 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
         value = ((fieldID == FieldID::StatP) ? GetXR1().GetAtmPressure() : GetXR1().GetDynPressure());
         if (units == Units::u_met) // metric
         {
-            sprintf(valueStr, "%.4lf kPa", (value / 1000));
+            FormatCellValue(cache, valueStr, (value / 1000), 4, " kPa");
         }
         else // imperial
         {
             value = PaToPsi(value);
-            sprintf(valueStr, "%.4lf psi", value);
+            FormatCellValue(cache, valueStr, value, 4, " psi");
         }
         break;
 
@@ -286,17 +287,17 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
         value = GetXR1().GetExternalTemperature();   // Kelvin
         if (units == Units::u_K)
         {
-            sprintf(valueStr, "%.4lf K", value);
+            FormatCellValue(cache, valueStr, value, 4, " K");
         }
         else if (units == Units::u_C)
         {
             value = KelvinToCelsius(value);
-            sprintf(valueStr, "%.4lf C", value);
+            FormatCellValue(cache, valueStr, value, 4, " C");
         }
         else    // Fahrenheit
         {
             value = KelvinToFahrenheit(value);
-            sprintf(valueStr, "%.4lf F", value);
+            FormatCellValue(cache, valueStr, value, 4, " F");
         }
         break;
 
@@ -307,7 +308,7 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
             sprintf(valueStr, "---");
         else
         {
-            sprintf(valueStr, "%.3lf", (value * DEG));
+            FormatCellValue(cache, valueStr, (value * DEG), 3, "");
         }
     }
     break;
@@ -319,12 +320,12 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
         value = (GetXR1().GroundContact() ? 0 : v.y);      // in m/s
         if (units == Units::u_met) // metric
         {
-            sprintf(valueStr, "%+.2lf m/s", value);
+            FormatCellValue(cache, valueStr, value, 2, " m/s", true);
         }
         else // imperial
         {
             value = MetersToFeet(value);    // feet per second
-            sprintf(valueStr, "%+.2lf fps", value);
+            FormatCellValue(cache, valueStr, value, 2, " fps", true);
         }
     }
     break;
@@ -343,47 +344,47 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
 
         if (units == Units::u_met)  // metric
         {
-            sprintf(valueStr, "%.4lf m/s", value);
+            FormatCellValue(cache, valueStr, value, 4, " m/s");
         }
         else if (units == Units::u_imp)    // imperial
         {
             value = MetersToFeet(value);
-            sprintf(valueStr, "%.4lf fps", value);
+            FormatCellValue(cache, valueStr, value, 4, " fps");
         }
         else  // G
         {
             value = Mps2ToG(value);
-            sprintf(valueStr, "%.6lf G", value);
+            FormatCellValue(cache, valueStr, value, 6, " G");
         }
     }
     break;
 
     case FieldID::Mass:
         value = GetXR1().GetMass(); // in kg
-        const char* pFormatStr;
+        int decimals;
         if (units == Units::u_met) // metric
         {
             if (value > 999999.9)
-                pFormatStr = "%.1lf kg";
+                decimals = 1;
             else if (value > 99999.9)
-                pFormatStr = "%.2lf kg";
+                decimals = 2;
             else
-                pFormatStr = "%.3lf kg";
+                decimals = 3;
 
-            sprintf(valueStr, "%.3lf kg", value);
+            FormatCellValue(cache, valueStr, value, 3, " kg");
         }
         else    // imperial
         {
             value = KgToPounds(value);
 
             if (value > 999999.9)
-                pFormatStr = "%.1lf lb";
+                decimals = 1;
             else if (value > 99999.9)
-                pFormatStr = "%.2lf lb";
+                decimals = 2;
             else
-                pFormatStr = "%.3lf lb";
+                decimals = 3;
 
-            sprintf(valueStr, pFormatStr, value);
+            FormatCellValue(cache, valueStr, value, decimals, " lb");
         }
         break;
 
@@ -392,7 +393,7 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
         ELEMENTS e;
         GetVessel().GetElements(nullptr, e, nullptr, 0, FRAME_EQU);  // this is only expensive on the first call to it in this frame
         value = e.e;
-        sprintf(valueStr, "%.5lf", value);
+        FormatCellValue(cache, valueStr, value, 5, "");
     }
     break;
 
@@ -401,7 +402,7 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
         ELEMENTS e;
         GetVessel().GetElements(nullptr, e, nullptr, 0, FRAME_EQU);
         value = e.i * DEG;  // in degrees
-        sprintf(valueStr, "%.4lf", value);  // reduce to 11 chars for slight clipping issue
+        FormatCellValue(cache, valueStr, value, 4, "");  // reduce to 11 chars for slight clipping issue
     }
     break;
 
@@ -421,11 +422,11 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
         }
 
         if (fabs(value) >= 1e7)  // >= 10,000,000 seconds?
-            sprintf(valueStr, "%.4lf M", (value / 1e6));
+            FormatCellValue(cache, valueStr, (value / 1e6), 4, " M");
         else if (fabs(value) >= 1e4)  // >= 10,000 seconds?
-            sprintf(valueStr, "%.4lf K", (value / 1e3));
+            FormatCellValue(cache, valueStr, (value / 1e3), 4, " K");
         else
-            sprintf(valueStr, "%.2lf", value);
+            FormatCellValue(cache, valueStr, value, 2, "");
     }
     break;
 
@@ -459,13 +460,13 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
         if (units == Units::u_met)     // metric
         {
             if (fabs(value) >= 1e9)
-                sprintf(valueStr, "%.2lf gm", (value / 1e9));
+                FormatCellValue(cache, valueStr, (value / 1e9), 2, " gm");
             else if (fabs(value) >= 1e7)   // >= 10,000 km?
-                sprintf(valueStr, "%.2lf mm", (value / 1e6));
+                FormatCellValue(cache, valueStr, (value / 1e6), 2, " mm");
             else if (fabs(value) >= 1e3)
-                sprintf(valueStr, "%.2lf km", (value / 1e3));
+                FormatCellValue(cache, valueStr, (value / 1e3), 2, " km");
             else
-                sprintf(valueStr, "%.2lf m", value);
+                FormatCellValue(cache, valueStr, value, 2, " m");
         }
         else   // imperial
         {
@@ -475,13 +476,13 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
             // handle large mile distances here
             const double distInMiles = (value / 5280);
             if (fabs(distInMiles) >= 1e9)   // >= 1 billion miles?
-                sprintf(valueStr, "%.3lf gmi", (distInMiles / 1e9));  // do not clip
+                FormatCellValue(cache, valueStr, (distInMiles / 1e9), 3, " gmi");  // do not clip
             else if (fabs(distInMiles) >= 1e6)   // >= 1 million miles?
-                sprintf(valueStr, "%.3lf mmi", (distInMiles / 1e6));  // do not clip
+                FormatCellValue(cache, valueStr, (distInMiles / 1e6), 3, " mmi");  // do not clip
             else if (fabs(value) >= 1e5)  // >= 100,000 feet?
-                sprintf(valueStr, "%.2lf mi", distInMiles);
+                FormatCellValue(cache, valueStr, distInMiles, 2, " mi");
             else
-                sprintf(valueStr, "%.2lf ft", value);
+                FormatCellValue(cache, valueStr, value, 2, " ft");
         }
     }
     break;
@@ -503,7 +504,7 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
             value = GetVessel().GetAOA();
 
         value *= DEG;   // convert to degrees
-        sprintf(valueStr, "%+.3lf", value);
+        FormatCellValue(cache, valueStr, value, 3, "", true);
         break;
 
     case FieldID::Long:
@@ -516,13 +517,13 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
         else
         {
             double pos = ((fieldID == FieldID::Long) ? longitude : latitude) * DEG;
-            char dir;
+            const char *pDirSuffix;     // degree symbol and direction
             if (pos < 0)
-                dir = ((fieldID == FieldID::Long) ? 'W' : 'S');
+                pDirSuffix = ((fieldID == FieldID::Long) ? " W" : " S");
             else
-                dir = ((fieldID == FieldID::Long) ? 'E' : 'N');
+                pDirSuffix = ((fieldID == FieldID::Long) ? " E" : " N");
 
-            sprintf(valueStr, "%.5lf %c", fabs(pos), dir);
+            FormatCellValue(cache, valueStr, fabs(pos), 5, pDirSuffix);
         }
     }
     break;
@@ -598,16 +599,16 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
         if (value >= 1000)
         {
             if (units == Units::u_met)
-                sprintf(valueStr, "%.3lf kN", value / 1000);
+                FormatCellValue(cache, valueStr, value / 1000, 3, " kN");
             else  // imperial
-                sprintf(valueStr, "%.3lf kLb", value / 1000);
+                FormatCellValue(cache, valueStr, value / 1000, 3, " kLb");
         }
         else    // RCS thrust is very small
         {
             if (units == Units::u_met)
-                sprintf(valueStr, "%.3lf N", value);
+                FormatCellValue(cache, valueStr, value, 3, " N");
             else  // imperial
-                sprintf(valueStr, "%.3lf lb", NewtonsToPounds(value));
+                FormatCellValue(cache, valueStr, NewtonsToPounds(value), 3, " lb");
         }
     }
     break;
@@ -634,17 +635,17 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
 
         if (units == Units::u_K)
         {
-            sprintf(valueStr, "%.3lf K", value);
+            FormatCellValue(cache, valueStr, value, 3, " K");
         }
         else if (units == Units::u_C)
         {
             value = KelvinToCelsius(value);
-            sprintf(valueStr, "%.3lf C", value);
+            FormatCellValue(cache, valueStr, value, 3, " C");
         }
         else    // Fahrenheit
         {
             value = KelvinToFahrenheit(value);
-            sprintf(valueStr, "%.3lf F", value);
+            FormatCellValue(cache, valueStr, value, 3, " F");
         }
     }
     break;
@@ -658,3 +659,89 @@ void SecondaryHUDArea::PopulateCell(SecondaryHUDMode::Cell& cell)
     strncpy(cell.valueStr, valueStr, MAX_CELL_VALUE_LENGTH);
     cell.valueStr[MAX_CELL_VALUE_LENGTH] = 0;   // terminate
 }
+
+// Format a value with a fixed number of decimal places followed by a units suffix; the output is identical to
+// sprintf's "%.<decimals>lf<suffix>" (or "%+.<decimals>lf<suffix>" if forceSign is true), but locale-independent and much faster.
+// If the digits to be displayed are unchanged since the last call for this cell, the cached text is reused.
+// cache = formatting cache for this cell
+// pValueStrOut = output buffer; must be large enough for the formatted value
+// pSuffix = units suffix, e.g., " kg"; must be a static string
+void SecondaryHUDArea::FormatCellValue(CellCache &cache, char *pValueStrOut, const double value, const int decimals, const char *pSuffix, const bool forceSign)
+{
+    __int64 scaledValue;
+    if (!QuantizeFixed(value, decimals, scaledValue))
+    {
+        // value is out of range for fast formatting, or it is too close to a rounding boundary for us to match sprintf exactly
+        sprintf(pValueStrOut, (forceSign ? "%+.*lf%s" : "%.*lf%s"), decimals, value, pSuffix);
+        cache.decimals = -1;    // invalidate
+        return;
+    }
+
+    const bool isNegative = (signbit(value) != 0);  // sprintf renders -0.0 as "-0.00", so we do too
+    if ((scaledValue == cache.scaledValue) && (isNegative == cache.isNegative) && (decimals == cache.decimals) && 
+        (pSuffix == cache.pSuffix) && (forceSign == cache.forceSign))
+    {
+        strcpy(pValueStrOut, cache.valueStr);   // nothing visible changed
+        return;
+    }
+
+    // render the digits from right to left
+    char digits[32];
+    char *pDigit = digits + sizeof(digits);
+    unsigned __int64 remaining = static_cast<unsigned __int64>(scaledValue);
+    for (int i = 0; i < decimals; i++)
+    {
+        *--pDigit = static_cast<char>('0' + (remaining % 10));
+        remaining /= 10;
+    }
+    if (decimals > 0)
+        *--pDigit = '.';
+    do
+    {
+        *--pDigit = static_cast<char>('0' + (remaining % 10));
+        remaining /= 10;
+    } while (remaining > 0);
+
+    char *pOut = pValueStrOut;
+    if (isNegative)
+        *pOut++ = '-';
+    else if (forceSign)
+        *pOut++ = '+';
+    const size_t digitCount = (digits + sizeof(digits)) - pDigit;
+    memcpy(pOut, pDigit, digitCount);
+    strcpy(pOut + digitCount, pSuffix);
+
+    // save for next time; the cell only displays MAX_CELL_VALUE_LENGTH characters
+    cache.scaledValue = scaledValue;
+    cache.isNegative = isNegative;
+    cache.decimals = decimals;
+    cache.pSuffix = pSuffix;
+    cache.forceSign = forceSign;
+    strncpy(cache.valueStr, pValueStrOut, MAX_CELL_VALUE_LENGTH);
+    cache.valueStr[MAX_CELL_VALUE_LENGTH] = 0;
+}
+
+// Scale the absolute value by 10^decimals and round it to an integer, the same way sprintf rounds when formatting it.
+// Returns: true on success, or false if the value must be formatted by sprintf instead: i.e., it is not finite, 
+// it is too large, or its exact decimal value is too close to a rounding boundary to be certain how sprintf would round it.
+bool SecondaryHUDArea::QuantizeFixed(const double value, const int decimals, __int64 &scaledValueOut)
+{
+    static const double s_powersOfTen[] = { 1, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8 };
+    if ((decimals < 0) || (decimals >= static_cast<int>(_countof(s_powersOfTen))))
+        return false;
+
+    // Note: this is also false for NaN
+    const double scaled = fabs(value) * s_powersOfTen[decimals];
+    if (!(scaled < 1e12))
+        return false;   // the rounding error in 'scaled' could exceed the tolerance below
+
+    // The product above is within 2^-53 * 1e12 (about 1e-4) of the exact product, so we can only be sure how the exact
+    // value rounds if its fraction is not close to one-half.
+    const double whole = floor(scaled);
+    const double fraction = scaled - whole;
+    if (fabs(fraction - 0.5) < 1e-3)
+        return false;
+
+    scaledValueOut = static_cast<__int64>(whole) + ((fraction > 0.5) ? 1 : 0);
+    return true;
+}
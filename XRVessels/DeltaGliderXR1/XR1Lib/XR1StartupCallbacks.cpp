@@ -44,6 +44,7 @@ void DeltaGliderXR1::clbkSetClassCaps(FILEHANDLE cfg)
 
     // Note: this must be invoked here instead of the constructor so the subclass may override it!
     DefineAnimations();
+    BuildXRAnimationRegistry();   // must follow DefineAnimations
 
     // *************** physical parameters **********************
 
@@ -183,111 +183,76 @@ bool DeltaGliderXR1::clbkPanelRedrawEvent(const int areaID, const int event, SUR
     if (event == PANEL_REDRAW_ALWAYS)
     {
         // NOTE: we want to check *realtime* deltas, not *simulation time* here: repaint frequency should not
-        // vary based on time acceleration.
-        const double uptime = GetSystemUptime();  // will always count up
+        // vary based on time acceleration.  oapiGetSysTime is sampled from Orbiter's high-resolution clock once per frame,
+        // so every area checked this frame sees the same time.
+        m_redrawScheduler.SetFrameTime(oapiGetSysTime());
 
-        // check for area IDs that have custom refresh rates
+        // Each area's refresh interval is looked up once and then cached in the scheduler.
+        if (!m_redrawScheduler.HasRedrawInterval(areaID))
+            m_redrawScheduler.SetRedrawInterval(areaID, GetPanelRedrawInterval(areaID));
+
+        bool redrawDue;
         switch (areaID)
         {
-        case AID_MULTI_DISPLAY:
-            if (uptime < m_nextMDARefresh)
-                return false;
-
-            // update for next interval
-            m_nextMDARefresh = uptime + GetXR1Config()->MDAUpdateInterval;
-            break;
-
         case AID_SECONDARY_HUD:
-        {
-            // only delay rendering if the HUD is fully deployed!
-            PopupHUDArea* pHud = static_cast<PopupHUDArea*>(GetArea(PANEL_MAIN, AID_SECONDARY_HUD));  // will never be null
-            if (pHud->GetState() == PopupHUDArea::OnOffState::On)
-            {
-                if (uptime < m_nextSecondaryHUDRefresh)
-                    return false;
-            }
-            else
-            {
-                // else HUD is not fully deployed, so let's refresh it according to the default panel refresh rate rather than each frame so we don't cause a framerate stutter while the HUD is deploying
-                goto panel_default_refresh;
-            }
-
-            // update for next interval
-            m_nextSecondaryHUDRefresh = uptime + GetXR1Config()->SecondaryHUDUpdateInterval;
-            break;
-        }
-
         case AID_TERTIARY_HUD:
         {
-            // only delay rendering if the HUD is fully deployed!
-            PopupHUDArea* pHud = static_cast<PopupHUDArea*>(GetArea(PANEL_MAIN, AID_TERTIARY_HUD));  // will never be null
+            // Only delay rendering if the HUD is fully deployed!  Otherwise refresh it according to the default panel refresh rate 
+            // rather than each frame so we don't cause a framerate stutter while the HUD is deploying.
+            PopupHUDArea *pHud = static_cast<PopupHUDArea *>(GetArea(PANEL_MAIN, areaID));  // will never be null
             if (pHud->GetState() == PopupHUDArea::OnOffState::On)
-            {
-                if (uptime < m_nextTertiaryHUDRefresh)
-                    return false;
-            }
+                redrawDue = m_redrawScheduler.IsRedrawDue(areaID);
             else
-            {
-                // else HUD is not fully deployed, so let's refresh it according to the default panel refresh rate rather than each frame so we don't cause a framerate stutter while the HUD is deploying
-                goto panel_default_refresh;
-            }
-
-            // update for next interval
-            m_nextTertiaryHUDRefresh = uptime + GetXR1Config()->TertiaryHUDUpdateInterval;
+                redrawDue = m_redrawScheduler.IsRedrawDue(areaID, GetXR1Config()->PanelUpdateInterval);
             break;
         }
 
-        case AID_HORIZON:
-        {
-            if (uptime < m_nextArtificialHorizonRefresh)
-                return false;
-
-            // update for next interval
-            m_nextArtificialHorizonRefresh = uptime + GetXR1Config()->ArtificialHorizonUpdateInterval;
+        default:
+            redrawDue = m_redrawScheduler.IsRedrawDue(areaID);
             break;
         }
 
-        default:
-        panel_default_refresh:
-            // defensive code: if GetXR1Config()->PanelUpdateInterval == 0, skip all these checks and just update each frame
-            if (GetXR1Config()->PanelUpdateInterval > 0)
-            {
-                // for all other PANEL_REDRAW_ALWAYS components, limit them to a master framerate for the sake of performance (e.g., 60 fps)
-                // retrieve the next uptime for this particular component
-                auto it = m_nextRedrawAlwaysRefreshMap.find(areaID);
-                double* pNextAreaRefresh = nullptr;  // points to it->second in m_nextRedrawAlwaysRefreshMap 
-                if (it != m_nextRedrawAlwaysRefreshMap.end())
-                {
-                    // area has a uptime in the map, so let's test against that
-                    pNextAreaRefresh = &(it->second);
-                }
-                else
-                {
-                    // no refresh uptime in the map yet for this area, so let's add one with a refresh uptime of now (for immediate update)
-                    // Note: pr.first = new map entry, pr.second = insertion status: true if inserted successfully, false if already in map (should never happen here!)
-                    pair<HASHMAP_UINT_DOUBLE::iterator, bool> pr = m_nextRedrawAlwaysRefreshMap.insert(uint_double_Pair(areaID, uptime));
-                    _ASSERTE(pr.second);  // the above insert should always succeed
-                    pNextAreaRefresh = &((pr.first)->second);  // points into uptime of map entry
-                }
-
-                if (uptime < *pNextAreaRefresh)
-                    return false;   // not time to update this area yet
-#if 0 // debug
-                if (areaID == AID_ACC_SCALE)  // arbitrary
-                    sprintf(oapiDebugString(), "uptime=%lf, next AID_ACC_SCALE refresh=%lf", uptime, *pNextAreaRefresh);
-#endif
-                // update this area's nextUpdateSimt for next interval
-                * pNextAreaRefresh = uptime + GetXR1Config()->PanelUpdateInterval;
-                break;
-            }
-        }
-        // DEBUG: sprintf(oapiDebugString(), "uptime=%lf, m_nextTertiaryHUDRefresh=%lf", uptime, m_nextTertiaryHUDRefresh);
+        if (!redrawDue)
+            return false;   // not time to update this area yet
     }
 
     // let the superclass dispatch the redraw event
     return VESSEL3_EXT::clbkPanelRedrawEvent(areaID, event, surf);
 }
 
+// Returns the realtime interval in seconds between PANEL_REDRAW_ALWAYS redraws of the supplied area; 0 = redraw every frame.
+// Subclasses may override this to add their own custom refresh rates, but should invoke this base class method for all other areas.
+double DeltaGliderXR1::GetPanelRedrawInterval(const int areaID) const
+{
+    double retVal;
+    switch (areaID)
+    {
+    case AID_MULTI_DISPLAY:
+        retVal = GetXR1Config()->MDAUpdateInterval;
+        break;
+
+    case AID_SECONDARY_HUD:
+        retVal = GetXR1Config()->SecondaryHUDUpdateInterval;   // when fully deployed
+        break;
+
+    case AID_TERTIARY_HUD:
+        retVal = GetXR1Config()->TertiaryHUDUpdateInterval;    // when fully deployed
+        break;
+
+    case AID_HORIZON:
+        retVal = GetXR1Config()->ArtificialHorizonUpdateInterval;
+        break;
+
+    default:
+        // for all other PANEL_REDRAW_ALWAYS components, limit them to a master framerate for the sake of performance (e.g., 60 fps)
+        // Note: a PanelUpdateInterval of 0 means update each frame
+        retVal = GetXR1Config()->PanelUpdateInterval;
+        break;
+    }
+
+    return retVal;
+}
+
 // --------------------------------------------------------------
 // Respond to playback event
 // NOTE: do not use spaces in any of these event ID strings.
@@ -473,6 +438,12 @@ void DeltaGliderXR1::clbkVisualDestroyed(VISHANDLE vis, int refcount)
 // --------------------------------------------------------------
 void DeltaGliderXR1::clbkPreStep(double simt, double simdt, double mjd)
 {
+#ifdef _DEBUG
+    // start counting SetAnimation calls for this frame
+    m_setAnimationCallsLastFrame = m_setAnimationCallsThisFrame;
+    m_setAnimationCallsThisFrame = 0;
+#endif
+
     // calculate max scramjet thrust
     ScramjetThrust();
 
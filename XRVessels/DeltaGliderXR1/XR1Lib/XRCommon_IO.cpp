@@ -26,6 +26,181 @@
 #include "DeltaGliderXR1.h"
 #include "XR1MultiDisplayArea.h"
 #include "XRCommon_IO.h"
+#include "stringhasher.h"
+
+#include <ctype.h>
+
+// IDs of the scenario lines recognized by ParseXRCommonScenarioLine
+enum class XRScenarioLine
+{
+    UNKNOWN,        // not an XR line; the caller should pass it to Orbiter
+    NOSECONE,
+    APU_STATUS,
+    EXTCOOLING_STATUS,
+    SECONDARY_HUD,
+    ADCTRL_MODE,
+    LAST_ACTIVE_SECONDARY_HUD,
+    APU_FUEL_QTY,
+    LOX_QTY,
+    CABIN_O2_LEVEL,
+    COOLANT_TEMP,
+    CREW_STATE,
+    COGSHIFT_MODES,
+    GIMBAL_BUTTON_STATES,
+    INTERNAL_SYSTEMS_FAILURE,
+    MWS_ACTIVE,
+    TAKEOFF_LANDING_CALLOUTS,
+    IS_CRASHED,
+    CRASH_MSG,
+    ACTIVE_MDM,
+    MET_STARTING_MJD,
+    INTERVAL1_ELAPSED_TIME,
+    INTERVAL2_ELAPSED_TIME,
+    MET_RUNNING,
+    INTERVAL1_RUNNING,
+    INTERVAL2_RUNNING,
+    TEMP_SCALE,
+    CUSTOM_AUTOPILOT_MODE,
+    AIRSPEED_HOLD_ENGAGED,
+    ATTITUDE_HOLD_DATA,
+    DESCENT_HOLD_DATA,
+    AIRSPEED_HOLD_DATA,
+    TERTIARY_HUD_ON,
+    CREW_DISPLAY_INDEX,
+    GEAR,
+    OVERRIDE_INTERLOCKS,
+    RCOVER,
+    AIRLOCK,
+    IAIRLOCK,
+    CHAMBER,
+    AIRBRAKE,
+    RADIATOR,
+    LADDER,
+    SCRAM_DOORS,
+    HOVER_DOORS,
+    HATCH,
+    SCRAM0DIR,
+    SCRAM1DIR,
+    HOVER_BALANCE,
+    MAIN0DIR,
+    MAIN1DIR,
+    TRIM,
+    LIGHTS,
+    DMG,            // "DMG_n"; matched by prefix, not via the hash table
+#ifdef MMU
+    XR1UMMU_CREW_DATA_VALID,
+#endif
+    PAYLOAD_SCREENS_DATA,
+    PAYLOAD_BAY_DOORS,
+    GRAPPLE_TARGET,
+    PARKING_BRAKES,
+    CONFIG_OVERRIDE_MAINFUELISP,
+    CONFIG_OVERRIDE_SCRAMFUELISP,
+    CONFIG_OVERRIDE_LOXCONSUMPTIONMULTIPLIER,
+    CONFIG_OVERRIDE_APUFUELBURNRATE,
+    CONFIG_OVERRIDE_COOLANTHEATINGRATE,
+    PRPLEVEL
+};
+
+// Tokenize the key at the beginning of the supplied scenario line and look it up in a hash table built on first use.
+// This replaces a chain of _strnicmp compares that every line (including every line that belongs to Orbiter) had to walk.
+//
+// Parameters:
+//   line: line to be parsed.
+//   keyLen: OUT: number of characters in the key; the key's values (if any) begin at line + keyLen
+//
+// Returns: ID of the line, or XRScenarioLine::UNKNOWN if the line is not an XR line
+static XRScenarioLine GetXRScenarioLine(const char *line, int &keyLen)
+{
+    // keys are case-insensitive, so all keys in the table must be uppercase
+    static const unordered_map<string_view, XRScenarioLine, stringhasher, stringhasher> s_lineMap =
+    {
+        { NOSECONE_SCN, XRScenarioLine::NOSECONE },
+        { "APU_STATUS", XRScenarioLine::APU_STATUS },
+        { "EXTCOOLING_STATUS", XRScenarioLine::EXTCOOLING_STATUS },
+        { "SECONDARY_HUD", XRScenarioLine::SECONDARY_HUD },
+        { "ADCTRL_MODE", XRScenarioLine::ADCTRL_MODE },
+        { "LAST_ACTIVE_SECONDARY_HUD", XRScenarioLine::LAST_ACTIVE_SECONDARY_HUD },
+        { "APU_FUEL_QTY", XRScenarioLine::APU_FUEL_QTY },
+        { "LOX_QTY", XRScenarioLine::LOX_QTY },
+        { "CABIN_O2_LEVEL", XRScenarioLine::CABIN_O2_LEVEL },
+        { "COOLANT_TEMP", XRScenarioLine::COOLANT_TEMP },
+        { "CREW_STATE", XRScenarioLine::CREW_STATE },
+        { "COGSHIFT_MODES", XRScenarioLine::COGSHIFT_MODES },
+        { "GIMBAL_BUTTON_STATES", XRScenarioLine::GIMBAL_BUTTON_STATES },
+        { "INTERNAL_SYSTEMS_FAILURE", XRScenarioLine::INTERNAL_SYSTEMS_FAILURE },
+        { "MWS_ACTIVE", XRScenarioLine::MWS_ACTIVE },
+        { "TAKEOFF_LANDING_CALLOUTS", XRScenarioLine::TAKEOFF_LANDING_CALLOUTS },
+        { "IS_CRASHED", XRScenarioLine::IS_CRASHED },
+        { "CRASH_MSG", XRScenarioLine::CRASH_MSG },
+        { "ACTIVE_MDM", XRScenarioLine::ACTIVE_MDM },
+        { "MET_STARTING_MJD", XRScenarioLine::MET_STARTING_MJD },
+        { "INTERVAL1_ELAPSED_TIME", XRScenarioLine::INTERVAL1_ELAPSED_TIME },
+        { "INTERVAL2_ELAPSED_TIME", XRScenarioLine::INTERVAL2_ELAPSED_TIME },
+        { "MET_RUNNING", XRScenarioLine::MET_RUNNING },
+        { "INTERVAL1_RUNNING", XRScenarioLine::INTERVAL1_RUNNING },
+        { "INTERVAL2_RUNNING", XRScenarioLine::INTERVAL2_RUNNING },
+        { "TEMP_SCALE", XRScenarioLine::TEMP_SCALE },
+        { "CUSTOM_AUTOPILOT_MODE", XRScenarioLine::CUSTOM_AUTOPILOT_MODE },
+        { "AIRSPEED_HOLD_ENGAGED", XRScenarioLine::AIRSPEED_HOLD_ENGAGED },
+        { "ATTITUDE_HOLD_DATA", XRScenarioLine::ATTITUDE_HOLD_DATA },
+        { "DESCENT_HOLD_DATA", XRScenarioLine::DESCENT_HOLD_DATA },
+        { "AIRSPEED_HOLD_DATA", XRScenarioLine::AIRSPEED_HOLD_DATA },
+        { "TERTIARY_HUD_ON", XRScenarioLine::TERTIARY_HUD_ON },
+        { "CREW_DISPLAY_INDEX", XRScenarioLine::CREW_DISPLAY_INDEX },
+        { "GEAR", XRScenarioLine::GEAR },
+        { "OVERRIDE_INTERLOCKS", XRScenarioLine::OVERRIDE_INTERLOCKS },
+        { "RCOVER", XRScenarioLine::RCOVER },
+        { "AIRLOCK", XRScenarioLine::AIRLOCK },
+        { "IAIRLOCK", XRScenarioLine::IAIRLOCK },
+        { "CHAMBER", XRScenarioLine::CHAMBER },
+        { "AIRBRAKE", XRScenarioLine::AIRBRAKE },
+        { "RADIATOR", XRScenarioLine::RADIATOR },
+        { "LADDER", XRScenarioLine::LADDER },
+        { "SCRAM_DOORS", XRScenarioLine::SCRAM_DOORS },
+        { "HOVER_DOORS", XRScenarioLine::HOVER_DOORS },
+        { "HATCH", XRScenarioLine::HATCH },
+        { "SCRAM0DIR", XRScenarioLine::SCRAM0DIR },
+        { "SCRAM1DIR", XRScenarioLine::SCRAM1DIR },
+        { "HOVER_BALANCE", XRScenarioLine::HOVER_BALANCE },
+        { "MAIN0DIR", XRScenarioLine::MAIN0DIR },
+        { "MAIN1DIR", XRScenarioLine::MAIN1DIR },
+        { "TRIM", XRScenarioLine::TRIM },
+        { "LIGHTS", XRScenarioLine::LIGHTS },
+#ifdef MMU
+        { "XR1UMMU_CREW_DATA_VALID", XRScenarioLine::XR1UMMU_CREW_DATA_VALID },
+#endif
+        { "PAYLOAD_SCREENS_DATA", XRScenarioLine::PAYLOAD_SCREENS_DATA },
+        { "PAYLOAD_BAY_DOORS", XRScenarioLine::PAYLOAD_BAY_DOORS },
+        { "GRAPPLE_TARGET", XRScenarioLine::GRAPPLE_TARGET },
+        { "PARKING_BRAKES", XRScenarioLine::PARKING_BRAKES },
+        { "CONFIG_OVERRIDE_MAINFUELISP", XRScenarioLine::CONFIG_OVERRIDE_MAINFUELISP },
+        { "CONFIG_OVERRIDE_SCRAMFUELISP", XRScenarioLine::CONFIG_OVERRIDE_SCRAMFUELISP },
+        { "CONFIG_OVERRIDE_LOXCONSUMPTIONMULTIPLIER", XRScenarioLine::CONFIG_OVERRIDE_LOXCONSUMPTIONMULTIPLIER },
+        { "CONFIG_OVERRIDE_APUFUELBURNRATE", XRScenarioLine::CONFIG_OVERRIDE_APUFUELBURNRATE },
+        { "CONFIG_OVERRIDE_COOLANTHEATINGRATE", XRScenarioLine::CONFIG_OVERRIDE_COOLANTHEATINGRATE },
+        { "PRPLEVEL", XRScenarioLine::PRPLEVEL }
+    };
+
+    // copy the uppercased key (everything up to the first whitespace) to our stack buffer
+    char key[64];
+    int len = 0;
+    for (; (line[len] > ' ') && (len < static_cast<int>(sizeof(key))); len++)
+        key[len] = static_cast<char>(toupper(static_cast<unsigned char>(line[len])));
+    keyLen = len;
+
+    if ((len >= 4) && (memcmp(key, "DMG_", 4) == 0))   // e.g., "DMG_12"
+    {
+        keyLen = 4;   // the damage index immediately follows the "DMG_" prefix
+        return XRScenarioLine::DMG;
+    }
+
+    if (len == static_cast<int>(sizeof(key)))
+        return XRScenarioLine::UNKNOWN;     // longer than any XR key
+
+    const auto it = s_lineMap.find(string_view(key, len));
+    return ((it != s_lineMap.end()) ? it->second : XRScenarioLine::UNKNOWN);
+}
 
 // --------------------------------------------------------------
 // Parse the supplied line for a recognized XR status lines. 
@@ -39,252 +214,354 @@
 bool DeltaGliderXR1::ParseXRCommonScenarioLine(char *line)
 {
     // Note: 'line' is used by our parse macros
-    int len;              // used by macros
+    int len;              // used by macros; set to the length of the line's key
     bool bFound = false;  // used by macros
 
-    IF_FOUND(NOSECONE_SCN)   // 'NOSECONE' or 'DOCKINGPORT'
+    switch (GetXRScenarioLine(line, len))
+    {
+    case XRScenarioLine::NOSECONE:  // 'NOSECONE' or 'DOCKINGPORT'
     {
         SSCANF2("%d%lf", &nose_status, &nose_proc);
-    } 
-    else IF_FOUND("APU_STATUS") 
+        break;
+    }
+
+    case XRScenarioLine::APU_STATUS:
     {
         SSCANF1("%d", &apu_status);  // no proc for this
-    } 
-    else IF_FOUND("EXTCOOLING_STATUS") 
+        break;
+    }
+
+    case XRScenarioLine::EXTCOOLING_STATUS:
     {
         SSCANF1("%d", &externalcooling_status);  // no proc for this
-    } 
-    else IF_FOUND("SECONDARY_HUD") 
+        break;
+    }
+
+    case XRScenarioLine::SECONDARY_HUD:
     {
         SSCANF1("%d", &m_secondaryHUDMode);
-    } 
-    else IF_FOUND("ADCTRL_MODE")    // BUGFIX IN DEFAULT DG: preserve ADCTRL mode
-    {      
+        break;
+    }
+
+    case XRScenarioLine::ADCTRL_MODE:  // BUGFIX IN DEFAULT DG: preserve ADCTRL mode
+    {
         int adCtrlMode = 7;     // default to ALL ON
         SSCANF1("%d", &adCtrlMode);
         SetADCtrlMode(adCtrlMode);
-    } 
-    else IF_FOUND("LAST_ACTIVE_SECONDARY_HUD") 
+        break;
+    }
+
+    case XRScenarioLine::LAST_ACTIVE_SECONDARY_HUD:
     {
         SSCANF1("%d", &m_lastSecondaryHUDMode);
-    } 
-    else IF_FOUND("APU_FUEL_QTY") 
+        break;
+    }
+
+    case XRScenarioLine::APU_FUEL_QTY:
     {
         double frac = 1.0;  // default to full if invalid value found
         SSCANF1("%lf", &frac);
         ValidateFraction(frac);     // make sure it's in range
         m_apuFuelQty = frac * APU_FUEL_CAPACITY;
-    } 
-    else IF_FOUND("LOX_QTY") 
+        break;
+    }
+
+    case XRScenarioLine::LOX_QTY:
     {
         const double maxLOXQty = GetXR1Config()->GetMaxLoxMass();
         double frac = 1.0;  // default to full if invalid value found
         SSCANF1("%lf", &frac);
         ValidateFraction(frac);     // make sure it's in range
         m_loxQty = frac * GetXR1Config()->GetMaxLoxMass();  // set main tank qty ONLY
-    } 
-    else IF_FOUND("CABIN_O2_LEVEL") 
+        break;
+    }
+
+    case XRScenarioLine::CABIN_O2_LEVEL:
     {
         SSCANF1("%lf", &m_cabinO2Level);
         ValidateFraction(m_cabinO2Level);   // check range
-    } 
-    else IF_FOUND("COOLANT_TEMP") 
+        break;
+    }
+
+    case XRScenarioLine::COOLANT_TEMP:
     {
         SSCANF1("%lf", &m_coolantTemp);
-    } 
-    else IF_FOUND("CREW_STATE") 
+        break;
+    }
+
+    case XRScenarioLine::CREW_STATE:
     {
         SSCANF1("%d", &m_crewState);
-    } 
-    else IF_FOUND("COGSHIFT_MODES") 
+        break;
+    }
+
+    case XRScenarioLine::COGSHIFT_MODES:
     {
         SSCANF_BOOL3(m_cogShiftAutoModeActive, m_cogShiftCenterModeActive, m_cogForceRecenter);
-    } 
-    else IF_FOUND("GIMBAL_BUTTON_STATES") 
+        break;
+    }
+
+    case XRScenarioLine::GIMBAL_BUTTON_STATES:
     {
         SSCANF_BOOL6(m_mainPitchCenteringMode, m_mainYawCenteringMode, m_mainDivMode, m_mainAutoMode, m_hoverCenteringMode, m_scramCenteringMode);
-    } 
-    else IF_FOUND("INTERNAL_SYSTEMS_FAILURE") 
+        break;
+    }
+
+    case XRScenarioLine::INTERNAL_SYSTEMS_FAILURE:
     {
         SSCANF_BOOL(m_internalSystemsFailure);
-    } 
-    else IF_FOUND("MWS_ACTIVE") 
+        break;
+    }
+
+    case XRScenarioLine::MWS_ACTIVE:
     {
         SSCANF_BOOL(m_MWSActive);
-    } 
-    else IF_FOUND("TAKEOFF_LANDING_CALLOUTS") 
+        break;
+    }
+
+    case XRScenarioLine::TAKEOFF_LANDING_CALLOUTS:
     {
         SSCANF5("%lf %lf %lf %lf %lf", &m_preStepPreviousAirspeed, &m_airborneTargetTime, &m_takeoffTime, &m_touchdownTime, &m_preStepPreviousVerticalSpeed);
-    } 
-    else IF_FOUND("IS_CRASHED") 
+        break;
+    }
+
+    case XRScenarioLine::IS_CRASHED:
     {
         SSCANF_BOOL(m_isCrashed);
-    } 
-    else IF_FOUND("CRASH_MSG") 
+        break;
+    }
+
+    case XRScenarioLine::CRASH_MSG:
     {
         SSCANF1("%s", &m_crashMessage);
         DecodeSpaces(m_crashMessage);   // Orbiter won't save or load spaces in params, so we work around it
-    } 
-    else IF_FOUND("ACTIVE_MDM") 
+        break;
+    }
+
+    case XRScenarioLine::ACTIVE_MDM:
     {
         SSCANF1("%d", &m_activeMultiDisplayMode);
-    } 
-    else IF_FOUND("MET_STARTING_MJD") 
+        break;
+    }
+
+    case XRScenarioLine::MET_STARTING_MJD:
     {
         SSCANF1("%lf", &m_metMJDStartingTime);
-    } 
-    else IF_FOUND("INTERVAL1_ELAPSED_TIME") 
+        break;
+    }
+
+    case XRScenarioLine::INTERVAL1_ELAPSED_TIME:
     {
         SSCANF1("%lf", &m_interval1ElapsedTime);
-    } 
-    else IF_FOUND("INTERVAL2_ELAPSED_TIME") 
+        break;
+    }
+
+    case XRScenarioLine::INTERVAL2_ELAPSED_TIME:
     {
         SSCANF1("%lf", &m_interval2ElapsedTime);
-    } 
-    else IF_FOUND("MET_RUNNING") 
+        break;
+    }
+
+    case XRScenarioLine::MET_RUNNING:
     {
         SSCANF_BOOL(m_metTimerRunning);
-    } 
-    else IF_FOUND("INTERVAL1_RUNNING") 
+        break;
+    }
+
+    case XRScenarioLine::INTERVAL1_RUNNING:
     {
         SSCANF_BOOL(m_interval1TimerRunning);
-    } 
-    else IF_FOUND("INTERVAL2_RUNNING") 
+        break;
+    }
+
+    case XRScenarioLine::INTERVAL2_RUNNING:
     {
         SSCANF_BOOL(m_interval2TimerRunning);
-    } 
-    else IF_FOUND("TEMP_SCALE") 
+        break;
+    }
+
+    case XRScenarioLine::TEMP_SCALE:
     {
         SSCANF1("%d", &m_activeTempScale);
-    } 
-    else IF_FOUND("CUSTOM_AUTOPILOT_MODE") 
+        break;
+    }
+
+    case XRScenarioLine::CUSTOM_AUTOPILOT_MODE:
     {
         AUTOPILOT ap;
         SSCANF1("%d", &ap);
         // must set the autopilot mode via the method so that RCS thrust levels are set correctly
         SetCustomAutopilotMode(ap, false, true);  // do not play sound; FORCE setting regardless of current door status (doors will be set elsewhere during the load)
-    } 
-    else IF_FOUND("AIRSPEED_HOLD_ENGAGED") 
+        break;
+    }
+
+    case XRScenarioLine::AIRSPEED_HOLD_ENGAGED:
     {
         SSCANF_BOOL(m_airspeedHoldEngaged);
-    } 
-    else IF_FOUND("ATTITUDE_HOLD_DATA") 
+        break;
+    }
+
+    case XRScenarioLine::ATTITUDE_HOLD_DATA:
     {
         // NOTE: m_centerOfLift is a new field for XR1 version 1.3, so it will not be there for pre-existing scenarios.  This would only be a factor
         // if the scenario was saved with the autpilot engaged, but we need to handle this.  The default value in those cases will be NEUTRAL_CENTER_OF_LIFT.
         m_centerOfLift = NEUTRAL_CENTER_OF_LIFT; // this is the value used if no value is present in the scenario
         *(reinterpret_cast<unsigned char *>(&m_holdAOA)) = '0';    // default to FALSE if we read an old scenario file below and m_holdAOA is not parsed
-		int i1, i2;
+        int i1, i2;
         SSCANF5("%lf %lf %d %d %lf", &m_setPitchOrAOA, &m_setBank, &i1, &i2, &m_centerOfLift);
-		m_initialAHBankCompleted = (i1 != 0);  // convert to bool (0 or 1)
-		m_holdAOA = (i2 != 0);  // convert to bool (0 or 1)
-    } 
-    else IF_FOUND("DESCENT_HOLD_DATA") 
+        m_initialAHBankCompleted = (i1 != 0);  // convert to bool (0 or 1)
+        m_holdAOA = (i2 != 0);  // convert to bool (0 or 1)
+        break;
+    }
+
+    case XRScenarioLine::DESCENT_HOLD_DATA:
     {
-		char i1;
+        char i1;
         SSCANF3("%lf %lf %c", &m_setDescentRate, &m_latchedAutoTouchdownMinDescentRate, &i1);
-		m_autoLand = (i1 != 0);  // convert to bool (0 or 1)
-    } 
-    else IF_FOUND("AIRSPEED_HOLD_DATA") 
+        m_autoLand = (i1 != 0);  // convert to bool (0 or 1)
+        break;
+    }
+
+    case XRScenarioLine::AIRSPEED_HOLD_DATA:
     {
         SSCANF1("%lf", &m_setAirspeed);
-    } 
-    else IF_FOUND("TERTIARY_HUD_ON") 
+        break;
+    }
+
+    case XRScenarioLine::TERTIARY_HUD_ON:
     {
         SSCANF_BOOL(m_tertiaryHUDOn);
-    } 
-    else IF_FOUND("CREW_DISPLAY_INDEX") 
+        break;
+    }
+
+    case XRScenarioLine::CREW_DISPLAY_INDEX:
     {
         SSCANF1("%d", &m_crewDisplayIndex);
         // range-check this
         if ((m_crewDisplayIndex < 0) || (m_crewDisplayIndex > MAX_PASSENGERS))  // includes room for pilot @ index 0
             m_crewDisplayIndex = 0;
-    } 
-    else IF_FOUND("GEAR") 
+        break;
+    }
+
+    case XRScenarioLine::GEAR:
     {
         SSCANF2("%d%lf", &gear_status, &gear_proc);
-    } 
-    else IF_FOUND("OVERRIDE_INTERLOCKS") 
+        break;
+    }
+
+    case XRScenarioLine::OVERRIDE_INTERLOCKS:
     {
         SSCANF_BOOL2(m_crewHatchInterlocksDisabled, m_airlockInterlocksDisabled);
-    } 
-    else IF_FOUND("RCOVER") 
+        break;
+    }
+
+    case XRScenarioLine::RCOVER:
     {
         SSCANF2("%d%lf", &rcover_status, &rcover_proc);
-    } 
-    else IF_FOUND("AIRLOCK") 
+        break;
+    }
+
+    case XRScenarioLine::AIRLOCK:
     {
         SSCANF2("%d%lf", &olock_status, &olock_proc);
-    } 
-    else IF_FOUND("IAIRLOCK") 
+        break;
+    }
+
+    case XRScenarioLine::IAIRLOCK:
     {
         SSCANF2("%d%lf", &ilock_status, &ilock_proc);
-    } 
-    else IF_FOUND("CHAMBER") 
+        break;
+    }
+
+    case XRScenarioLine::CHAMBER:
     {
         SSCANF2("%d%lf", &chamber_status, &chamber_proc);
-    } 
-    else IF_FOUND("AIRBRAKE") 
+        break;
+    }
+
+    case XRScenarioLine::AIRBRAKE:
     {
         SSCANF2("%d%lf", &brake_status, &brake_proc);
-    } 
-    else IF_FOUND("RADIATOR") 
+        break;
+    }
+
+    case XRScenarioLine::RADIATOR:
     {
         SSCANF2("%d%lf", &radiator_status, &radiator_proc);
-    } 
-    else IF_FOUND("LADDER")     // not used by some subclasses, but we can parse it just the same because we have a status and a proc for it in the base XR1 class 
+        break;
+    }
+
+    case XRScenarioLine::LADDER:  // not used by some subclasses, but we can parse it just the same because we have a status and a proc for it in the base XR1 class
     {
         SSCANF2("%d%lf", &ladder_status, &ladder_proc);
-    } 
-    else IF_FOUND("SCRAM_DOORS") 
+        break;
+    }
+
+    case XRScenarioLine::SCRAM_DOORS:
     {
         SSCANF2("%d%lf", &scramdoor_status, &scramdoor_proc);
-    } 
-    else IF_FOUND("HOVER_DOORS") 
+        break;
+    }
+
+    case XRScenarioLine::HOVER_DOORS:
     {
         SSCANF2("%d%lf", &hoverdoor_status, &hoverdoor_proc);
-    } 
-    else IF_FOUND("HATCH")    // not used by some subclasses, but we can parse it just the same because we have a status and a proc for it in the base XR1 class 
+        break;
+    }
+
+    case XRScenarioLine::HATCH:  // not used by some subclasses, but we can parse it just the same because we have a status and a proc for it in the base XR1 class
     {
         SSCANF2("%d%lf", &hatch_status, &hatch_proc);
-    } 
-    else IF_FOUND("SCRAM0DIR") 
+        break;
+    }
+
+    case XRScenarioLine::SCRAM0DIR:
     {
         VECTOR3 dir;
         dir.z = -21769.5;   // sanity-check
         SSCANF3("%lf%lf%lf", &dir.x, &dir.y, &dir.z);
         if (dir.z != -21769.5)  // did we read in all three values?
             SetThrusterDir(th_scram[0], dir);
-    } 
-    else IF_FOUND("SCRAM1DIR") 
+        break;
+    }
+
+    case XRScenarioLine::SCRAM1DIR:
     {
         VECTOR3 dir;
         dir.z = -21769.5;   // sanity-check
         SSCANF3("%lf%lf%lf", &dir.x, &dir.y, &dir.z);
         if (dir.z != -21769.5)  // did we read in all three values?
             SetThrusterDir(th_scram[1], dir);
-    } 
-    else IF_FOUND("HOVER_BALANCE") 
+        break;
+    }
+
+    case XRScenarioLine::HOVER_BALANCE:
     {
         SSCANF1("%lf", &m_hoverBalance);
-    } 
-    else IF_FOUND("MAIN0DIR") 
+        break;
+    }
+
+    case XRScenarioLine::MAIN0DIR:
     {
         VECTOR3 dir;
         dir.z = -21769.5;   // sanity-check
         SSCANF3("%lf%lf%lf", &dir.x, &dir.y, &dir.z);
         if (dir.z != -21769.5)  // did we read in all three values?
             SetThrusterDir(th_main[0], dir);
-    } 
-    else IF_FOUND("MAIN1DIR") 
+        break;
+    }
+
+    case XRScenarioLine::MAIN1DIR:
     {
         VECTOR3 dir;
         dir.z = -21769.5;   // sanity-check
         SSCANF3("%lf%lf%lf", &dir.x, &dir.y, &dir.z);
         if (dir.z != -21769.5)  // did we read in all three values?
             SetThrusterDir(th_main[1], dir);
-    } 
-    else IF_FOUND("TRIM") 
+        break;
+    }
+
+    case XRScenarioLine::TRIM:
     {
         double trim;
         SSCANF1("%lf", &trim);
@@ -295,106 +572,135 @@ bool DeltaGliderXR1::ParseXRCommonScenarioLine(char *line)
         else if (trim > 1.0)
             trim = 1.0;
         SetControlSurfaceLevel (AIRCTRL_ELEVATORTRIM, trim);
-    } 
+        break;
+    }
+
     // NOTE: "SKIN" must be parsed by each subclass because the path, texture names, and texture count may vary between vessels
-    else IF_FOUND("LIGHTS") 
+    case XRScenarioLine::LIGHTS:
     {
         int lgt[3];
         SSCANF3("%d%d%d", lgt+0, lgt+1, lgt+2);
         SetNavlight (lgt[0] != 0);
         SetBeacon (lgt[1] != 0);
         SetStrobe (lgt[2] != 0);
-    } 
-    else IF_FOUND("DMG_")  // starts with DMG_?
-    {   
+        break;
+    }
+
+    case XRScenarioLine::DMG:  // starts with DMG_?
+    {
         int dmgIndex;
         double fracIntegrity;
 
         SSCANF2("%d %lf", &dmgIndex, &fracIntegrity);
         ValidateFraction(fracIntegrity);  // keep in range
         SetDamageStatus((DamageItem)dmgIndex, fracIntegrity);   // this may be overridden by subclasses
+        break;
     }
+
 #ifdef MMU
-    else IF_FOUND("XR1UMMU_CREW_DATA_VALID") 
+    case XRScenarioLine::XR1UMMU_CREW_DATA_VALID:
     {
         SSCANF_BOOL(m_UMmuCrewDataValid); 
+        break;
     }
+
 #endif
-    else IF_FOUND("PAYLOAD_SCREENS_DATA")   // only applicable to payload-enabled vessels, but doesn't hurt to read it here
+    case XRScenarioLine::PAYLOAD_SCREENS_DATA:  // only applicable to payload-enabled vessels, but doesn't hurt to read it here
     {
         SSCANF4("%lf %d %d %d", &m_deployDeltaV, &m_grappleRangeIndex, &m_selectedSlotLevel, &m_selectedSlot);   // payload screen data
+        break;
     }
-	else IF_FOUND("PAYLOAD_BAY_DOORS")
-	{
-		SSCANF2("%d%lf", &bay_status, &bay_proc);
-	}
-    else IF_FOUND("GRAPPLE_TARGET")  // only applicable to payload-enabled vessels, but doesn't hurt to read it here
+
+    case XRScenarioLine::PAYLOAD_BAY_DOORS:
+    {
+        SSCANF2("%d%lf", &bay_status, &bay_proc);
+        break;
+    }
+
+    case XRScenarioLine::GRAPPLE_TARGET:  // only applicable to payload-enabled vessels, but doesn't hurt to read it here
     {
         // Allocate space for grapple target vessel name; this is only necessary until the pilot selects another target vessel.
         // This memory is freed in the destructor.
         SSCANF1("%s", m_grappleTargetVesselName);
+        break;
+    }
+
+    case XRScenarioLine::PARKING_BRAKES:
+    {
+        SSCANF_BOOL(m_parkingBrakesEngaged);
+        break;
     }
-	else IF_FOUND("PARKING_BRAKES")
-	{
-		SSCANF_BOOL(m_parkingBrakesEngaged);
-	}
 
     //=================================================================
     // BEGIN configuration file overrides
     //=================================================================
-    else IF_FOUND_CONFIG_OVERRIDE("MainFuelISP")
+    case XRScenarioLine::CONFIG_OVERRIDE_MAINFUELISP:
     {
         int val;
         SSCANF1("%d", &val);
         Validate(val, 0, MAX_MAINFUEL_ISP_CONFIG_OPTION);  // keep in range
         SET_CONFIG_OVERRIDE_INT(MainFuelISP, val);
+        break;
     }
-    else IF_FOUND_CONFIG_OVERRIDE("SCRAMFuelISP")
+
+    case XRScenarioLine::CONFIG_OVERRIDE_SCRAMFUELISP:
     {
         int val;
         SSCANF1("%d", &val);
         Validate(val, 0, 4);  // keep in range
         SET_CONFIG_OVERRIDE_INT(SCRAMFuelISP, val);
+        break;
     }
-    else IF_FOUND_CONFIG_OVERRIDE("LOXConsumptionMultiplier")
+
+    case XRScenarioLine::CONFIG_OVERRIDE_LOXCONSUMPTIONMULTIPLIER:
     {
         double val;
         SSCANF1("%lf", &val);
         Validate(val, 0.0, 10.0);  // keep in range
         SET_CONFIG_OVERRIDE_DOUBLE(LOXConsumptionMultiplier, val);
+        break;
     }
-    else IF_FOUND_CONFIG_OVERRIDE("APUFuelBurnRate")
+
+    case XRScenarioLine::CONFIG_OVERRIDE_APUFUELBURNRATE:
     {
         int val;
         SSCANF1("%d", &val);
         Validate(val, 0, 5);  // keep in range
         SET_CONFIG_OVERRIDE_INT(APUFuelBurnRate, val);
+        break;
     }
-    else IF_FOUND_CONFIG_OVERRIDE("CoolantHeatingRate")
+
+    case XRScenarioLine::CONFIG_OVERRIDE_COOLANTHEATINGRATE:
     {
         int val;
         SSCANF1("%d", &val);
         Validate(val, 0, 2);  // keep in range
         SET_CONFIG_OVERRIDE_INT(CoolantHeatingRate, val);
+        break;
     }
     //=================================================================
     // END configuration file overrides
     //=================================================================
-#ifdef MMU
-    else if (UMmu.LoadAllMembersFromOrbiterScenario(line)) 
-    {
-        // sprintf(oapiDebugString(), "Loaded UMMu crew member data from scenario file.");  // DEBUG ONLY
-		bFound = true;
-    } 
-#endif
-    else 
+
+    case XRScenarioLine::PRPLEVEL:
     {
         // WARNING: if ALL fuel tanks depleted, PRPLEVEL is not present in the scenario file!
-        IF_FOUND("PRPLEVEL") 
+        ParsePRPLevel(line, len);
+        // fall through to Orbiter's default parser (do not set bFound = true)
+        break;
+    }
+
+    default:    // not an XR line
+    {
+#ifdef MMU
+        if (UMmu.LoadAllMembersFromOrbiterScenario(line)) 
         {
-            ParsePRPLevel(line, len);
-            // fall through to Orbiter's default parser (do not set bFound = true)
-        }
+            // sprintf(oapiDebugString(), "Loaded UMMu crew member data from scenario file.");  // DEBUG ONLY
+            bFound = true;
+        } 
+#endif
+        break;
+    }
     }
 
     return bFound;     // set by macros
@@ -46,7 +46,7 @@ DeltaGliderXR1::DeltaGliderXR1 (OBJHANDLE hObj, int fmodel, XR1ConfigFileParser
     m_activeMultiDisplayMode(DEFAULT_MMID), m_activeTempScale(TempScale::Celsius), m_pMDA(nullptr),
     m_tertiaryHUDOn(true), m_damagedWingBalance(0), m_crashProcessed(false),
     m_infoWarningTextLineGroup(INFO_WARNING_BUFFER_LINES), m_mwsTestActive(false),
-    m_nextMDARefresh(0), m_nextSecondaryHUDRefresh(0), m_lastSecondaryHUDMode(0),
+    m_lastSecondaryHUDMode(0),
     m_metMJDStartingTime(-1), m_interval1ElapsedTime(-1), m_interval2ElapsedTime(-1),
     m_metTimerRunning(false), m_interval1TimerRunning(false), m_interval2TimerRunning(false),
     m_apuFuelQty(APU_FUEL_CAPACITY), m_mainFuelDumpInProgress(false), m_rcsFuelDumpInProgress(false),
@@ -60,7 +60,7 @@ DeltaGliderXR1::DeltaGliderXR1 (OBJHANDLE hObj, int fmodel, XR1ConfigFileParser
     m_crewState(CrewState::OK), m_coolantTemp(NOMINAL_COOLANT_TEMP), m_internalSystemsFailure(false),
     m_customAutopilotMode(AUTOPILOT::AP_OFF), m_airspeedHoldEngaged(false), m_setPitchOrAOA(0), m_setBank(0), m_initialAHBankCompleted(false), m_holdAOA(false),
     m_customAutopilotSuspended(false), m_airspeedHoldSuspended(false), m_setDescentRate(0), m_latchedAutoTouchdownMinDescentRate(-3), m_autoLand(false), m_maxShipHoverAcc(0),
-    m_dataHUDActive(false), m_setAirspeed(0), m_maxMainAcc(0), m_nextTertiaryHUDRefresh(0), m_nextArtificialHorizonRefresh(0),
+    m_dataHUDActive(false), m_setAirspeed(0), m_maxMainAcc(0),
     m_crewHatchInterlocksDisabled(false), m_airlockInterlocksDisabled(false), m_isRetroEnabled(false), m_isHoverEnabled(false), m_isScramEnabled(false),
     m_startupMainFuelFrac(0), m_startupRCSFuelFrac(0), m_startupSCRAMFuelFrac(0),  // NOTE: these values must be 0 and not -1!
     m_crewDisplayIndex(0), m_parsedScenarioFile(false), m_mmuCrewDataValid(false), 
@@ -76,7 +76,7 @@ DeltaGliderXR1::DeltaGliderXR1 (OBJHANDLE hObj, int fmodel, XR1ConfigFileParser
     m_deployDeltaV(0.2), m_grappleRangeIndex(0), m_selectedSlotLevel(1), m_selectedSlot(0),
     anim_bay(0), bay_status(DoorStatus::DOOR_CLOSED), bay_proc(0), m_requestSwitchToTwoDPanelNumber(-1),
     m_animFrontTireRotation(0), m_animRearTireRotation(0),
-    heatingmesh_tpl(nullptr), heatingmesh(nullptr),
+    heatingmesh_tpl(nullptr), heatingmesh(nullptr), m_heatingMeshVersion(0),
     m_animNoseGearCompression(0), m_animRearGearCompression(0),
     m_noseGearProc(1.0), m_rearGearProc(1.0),  // Note: must default to gear *fully uncompressed* here because compression may not be implemented
     m_pFuelDumpParticleStreamSpec(nullptr), m_SCRAMTankHidden(false), m_pBoilOffExhaustParticleStreamSpec(nullptr),
@@ -96,6 +96,8 @@ DeltaGliderXR1::DeltaGliderXR1 (OBJHANDLE hObj, int fmodel, XR1ConfigFileParser
 {
 #ifdef _DEBUG
     m_tweakedInternalValue = 0;  
+    m_setAnimationCallsThisFrame = 0;
+    m_setAnimationCallsLastFrame = 0;
 #endif
 
     // allocate and zero our spotlight pointer array
@@ -104,8 +106,6 @@ DeltaGliderXR1::DeltaGliderXR1 (OBJHANDLE hObj, int fmodel, XR1ConfigFileParser
         m_pSpotlights[i] = nullptr;
 
     // zero payload bay variables (unused by us)
-    for (int i=0; i < 3; i++)
-        m_nextPayloadScreensRefresh[i] = 0;
     *m_grappleTargetVesselName = 0;
 
     // normal initialization begins here
@@ -219,6 +219,7 @@ DeltaGliderXR1::~DeltaGliderXR1 ()
 {
     CleanUpAnimations();
 
+    WritePrePostStepProfile();  // no-op unless XR_PREPOSTSTEP_PROFILER is defined; must happen before our config (log) is freed
     delete GetXR1Config();
     delete ramjet;
 
@@ -24,6 +24,7 @@
 // ==============================================================
 
 #include "DeltaGliderXR1.h"
+#include "FileCacheWarmer.h"
 
 // invoked during vessel initialization
 // Returns: true if init successful, false if XRSound not loaded
@@ -91,6 +92,10 @@ bool DeltaGliderXR1::InitSound()
     XRSoundOnOff(XRSound::SubsonicCallout, false);
     XRSoundOnOff(XRSound::SonicBoom, false);
 
+    // Callouts and status messages load their WAV files on the sim thread right before they play, so read our sound
+    // files once in the background now; the first load of each file then comes from the OS file cache instead of the disk.
+    FileCacheWarmer::WarmDirectory(m_pXRSoundPath, ".wav");
+
     // load sounds
     LoadXR1Sound(SwitchOn, "SwitchOn1.wav", XRSound::PlaybackType::InternalOnly);
     LoadXR1Sound(SwitchOff, "SwitchOff1.wav", XRSound::PlaybackType::InternalOnly);
@@ -144,7 +149,23 @@ void DeltaGliderXR1::LoadXR1Sound(const Sound sound, const char* pFilename, XRSo
 
     // use member variable here so we can preserve the last file loaded for debugging purposes
     sprintf(m_lastWavLoaded, "%s\\%s", m_pXRSoundPath, pFilename);
+
+    // Callouts reload the same few slots over and over, usually with the same file as last time.  If this slot already
+    // holds this file and is not playing, the reload would only re-read the file from disk, so skip it.
+    // If the slot is playing we always reload it so that the sound restarts exactly as before.
+    LoadedWav *pLoadedWav = (((sound > NO_SOUND) && (sound <= TiresRolling)) ? &m_loadedWavs[sound] : nullptr);
+    if ((pLoadedWav != nullptr) && (pLoadedWav->playbackType == playbackType) &&
+        (pLoadedWav->filename.CompareNoCase(pFilename) == 0) && !m_pXRSound->IsWavPlaying(sound))
+    {
+        return;     // already loaded
+    }
+
     BOOL stat = m_pXRSound->LoadWav(sound, m_lastWavLoaded, playbackType);
+    if (pLoadedWav != nullptr)
+    {
+        pLoadedWav->filename = (stat ? pFilename : "");
+        pLoadedWav->playbackType = playbackType;
+    }
 #ifdef _DEBUG
     if (!stat)
         sprintf(oapiDebugString(), "ERROR: LoadXR1Sound: LoadWav failed, filename='%s'", pFilename);
@@ -269,8 +269,9 @@ void DeltaGliderXR1::NeutralAllControlSurfaces()
 // Show a fatal error message box and terminate Orbiter
 void DeltaGliderXR1::FatalError(const char* pMsg)
 {
-	// write to the log
+	// write to the log; we are about to exit, so write it to disk now instead of waiting for the log writer thread
 	GetXR1Config()->WriteLog(pMsg);
+	GetXR1Config()->FlushLog();
 
 	// close the main window so the dialog box will appear
 	const HWND mainWindow = GetForegroundWindow();
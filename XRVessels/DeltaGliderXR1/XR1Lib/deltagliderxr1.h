@@ -36,6 +36,7 @@
 #include "XRSound.h"
 #include "XR1ConfigFileParser.h"
 #include "TextBox.h"
+#include "RedrawScheduler.h"
 #include "XR1Globals.h"
 
 #ifdef MMU
@@ -262,10 +263,22 @@ public:
     // Note: no proc for fuel or LOX hatches: they "snap" open or closed
 	double nose_proc, scramdoor_proc, hoverdoor_proc, ladder_proc, gear_proc, rcover_proc, olock_proc, ilock_proc, chamber_proc, hatch_proc, radiator_proc, brake_proc;     // logical status
 
-    // WARNING: All code should invoke SetXRAnimation instead of SetXRAnimation!  The reason is that 
-    // SetXRAnimation always assumes that the handle is valid, and so SetXRAnimation is a virtual "gate" 
-    // method that allows each subclass to determine whether that animation is valid or not for that vessel.
-    virtual void SetXRAnimation(const UINT &anim, const double state) const;
+    // WARNING: All code should invoke SetXRAnimation instead of SetAnimation!  The reason is that 
+    // SetAnimation always assumes that the handle is valid, and so SetXRAnimation is a "gate" method that 
+    // only passes through handles each subclass registered as valid for that vessel in RegisterXRAnimations.
+    void SetXRAnimation(const UINT &anim, const double state) const;
+    void BuildXRAnimationRegistry();
+    virtual void RegisterXRAnimations();
+    void AllowXRAnimation(const UINT &anim);
+
+    // animation handle registry built by BuildXRAnimationRegistry: index = animation handle
+    vector<const UINT *> m_xrAnimationOwners;     // member variable that holds each valid handle; nullptr = handle not valid for this vessel
+    mutable vector<double> m_xrAnimationStates;   // last state passed to SetAnimation for each handle; -1 = not set yet
+#ifdef _DEBUG
+    mutable int m_setAnimationCallsThisFrame;     // SetAnimation calls made so far this frame
+    int m_setAnimationCallsLastFrame;             // SetAnimation calls made during the previous frame
+    int GetSetAnimationCallsLastFrame() const { return m_setAnimationCallsLastFrame; }
+#endif
 
 	UINT anim_gear;         // handle for landing gear animation
 	UINT anim_rcover;       // handle for retro cover animation
@@ -313,6 +326,7 @@ public:
 	DEVMESHHANDLE vcmesh;          // local VC mesh and global template
     MESHHANDLE heatingmesh_tpl;    // global template: used for hull heating effects (not used on the XR1)
     DEVMESHHANDLE heatingmesh;     // used for hull heating effects (not used on the XR1)
+    unsigned int m_heatingMeshVersion;  // incremented each time our visual obtains a new heatingmesh instance, which may reuse the old handle
 
 	THGROUP_HANDLE thg_main;
 	THGROUP_HANDLE thg_retro;
@@ -700,6 +714,11 @@ public:
     virtual bool SetExternalCoolingState(const bool bEnabled);
     virtual bool SetCrossFeedMode(XRXFEED_STATE state);
 
+    // API methods added in XRVesselCtrl version 4.1
+    virtual int GetStatusScreenTextIfChanged(char *pLinesOut, const int bufferSize, const int maxLinesToRetrieve, int &versionInOut) const;
+    int BuildStatusScreenText(char *pLinesOut, const int bufferSize, const int maxLinesToRetrieve) const;  // worker for the methods above
+    virtual bool LogPrePostStepProfile() const;
+
     //=====================================================================
 
     //
@@ -785,6 +804,16 @@ public:
         TiresRolling        // 62
     };  
 
+    // the file most recently loaded into each sound slot by LoadXR1Sound, so that identical reloads can be skipped
+    struct LoadedWav
+    {
+        LoadedWav() : playbackType(XRSound::PlaybackType::InternalOnly) { }
+
+        CString filename;       // empty = nothing loaded yet
+        XRSound::PlaybackType playbackType;
+    };
+    LoadedWav m_loadedWavs[TiresRolling + 1];   // index = Sound
+
     // enum defining different classes of sounds
     enum SoundType { ST_AudioStatusGreeting, ST_VelocityCallout, ST_AltitudeCallout, ST_DockingDistanceCallout, ST_InformationCallout, ST_RCSStatusCallout, ST_AFStatusCallout, ST_WarningCallout, ST_Other, ST_None };
 
@@ -1012,6 +1041,7 @@ public:
 
     // overridden base class methods
     virtual bool clbkPanelRedrawEvent(int areaID, int event, SURFHANDLE surf);
+    virtual double GetPanelRedrawInterval(const int areaID) const;
 
     // payload bay methods for subclasses to use; these are not linked into the XR1
     virtual bool DeployPayload(const int slotNumber, const bool showMessage);
@@ -1036,7 +1066,6 @@ public:
     // TRANSIENT payload data; used only by subclasses!
     ATTACHMENTHANDLE m_dummyAttachmentPoint; 
     XRPayloadBay *m_pPayloadBay;
-    double m_nextPayloadScreensRefresh[3];  // simt of next refresh for our three screens
     vector<const XRGrappleTargetVessel *> m_xrGrappleTargetVesselsInDisplayRange;   // list of XRGrappleTargetVessel objects; may be empty
     static HWND s_hPayloadEditorDialog;     // if non-zero, contains the window handle of the payload editor dialog; this is GLOBAL across all Ravenstar vessels since the dialog is a singleton
     // subclass bay doors, if any; these are not referenced by our class here
@@ -1099,16 +1128,8 @@ protected:
     virtual void ReinitializeDamageableControlSurfaces();  // creates control surfaces for any handles below that are zero
 	CTRLSURFHANDLE hLeftAileron, hRightAileron, hElevator, hElevatorTrim;         // control surface handles
 
-    // custom refresh data
-    double m_nextMDARefresh;            // simt for next PANEL_REDRAW_ALWAYS event
-    double m_nextSecondaryHUDRefresh;   // simt for next PANEL_REDRAW_ALWAYS event
-    double m_nextTertiaryHUDRefresh;    // simt for next PANEL_REDRAW_ALWAYS event
-    double m_nextArtificialHorizonRefresh;  // simt for next PANEL_REDRAW_ALWAYS event
-
-    // map of areaID -> simt of next update (only contains PANEL_REDRAW_ALWAYS areas)
-    typedef unordered_map<unsigned int, double> HASHMAP_UINT_DOUBLE;
-    typedef pair<unsigned int, double> uint_double_Pair;
-    HASHMAP_UINT_DOUBLE m_nextRedrawAlwaysRefreshMap;  // key=area ID, value = simt of next update for this component
+    // realtime redraw deadlines for all PANEL_REDRAW_ALWAYS areas
+    RedrawScheduler m_redrawScheduler;
 
     // bitmask that tracks all fuel-related config file overrides that were loaded with this scenario
 #define CONFIG_OVERRIDE_MainFuelISP               0x00000001
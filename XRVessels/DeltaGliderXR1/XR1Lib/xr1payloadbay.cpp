@@ -31,6 +31,7 @@
 #include "DeltaGliderXR1.h"
 #include "XR1PayloadBay.h"
 #include "XRPayloadBaySlot.h"
+#include "XRPayloadSpatialIndex.h"
 
 //-------------------------------------------------------------------------
 // XR1PayloadBay methods
@@ -418,6 +419,7 @@ int DeltaGliderXR1::GrappleAllPayload()
 
     // process each targetVesselIndex once and only once; we need this for sorting
     vector<int> processedIndexes;
+    vector<int> freeSlots;  // declared here for efficiency
     while (processedIndexes.size() < m_xrGrappleTargetVesselsInDisplayRange.size())
     {
         double largestTotalSlots = -1;  // largest (length + width + height) value found in this loop
@@ -470,8 +472,9 @@ int DeltaGliderXR1::GrappleAllPayload()
             {
                 // vessel is OK to grapple!
 
-                // try to attach this vessel using each slot until we find one that fits
-                for (int slotNumber = 1; slotNumber <= m_pPayloadBay->GetSlotCount(); slotNumber++)
+                // try to attach this vessel in each slot where it fits, best slot first
+                m_pPayloadBay->GetFreeSlotsForPayload(*pGrappleTarget->GetTargetVessel(), freeSlots);
+                for (int slotNumber : freeSlots)
                 {
                     if (m_pPayloadBay->AttachChild(pGrappleTarget->GetTargetVessel()->GetHandle(), slotNumber))
                     {
@@ -646,57 +649,48 @@ bool DeltaGliderXR1::IsGrappleTargetVesselValidAndInDisplayRange(const XRGrapple
     return retVal;
 }
 
-// Iterate through all vessels and rebuild 'm_xrGrappleTargetVesselsInDisplayRange', which contains the 
-// list of vessels in range of 'GRAPPLE_DISPLAY_RANGES[m_grappleRangeIndex]'.
-// NOTE: this is a relatively expensive method, so you should only call it when necessary; i.e., not every frame.
+// Rebuild 'm_xrGrappleTargetVesselsInDisplayRange', which contains the list of vessels in range of 'GRAPPLE_DISPLAY_RANGES[m_grappleRangeIndex]'.
+// The candidate vessels come from the XRPayloadSpatialIndex shared by all XR vessels, which only contains XRPayload-enabled vessels
+// and is rebuilt at most once per frame, so this does not need to check every vessel in the simulation.
+// NOTE: this is still not free, so you should only call it when necessary; i.e., not every frame.
 // Also note that the currently-selected grapple target (m_grappleTargetVesselName), if any, is not changed.
 void DeltaGliderXR1::RefreshGrappleTargetsInDisplayRange()
 {
-    const double range = GetGrappleDisplayRange();
-
     m_xrGrappleTargetVesselsInDisplayRange.clear();    // this will be rebuilt below
 
-    // NOTE: Orbiter tends to keep vessels in a given order, so we don't need to worry about the
-    // list being constructed out-of-order from the current order here.
-    for (unsigned int i=0; i < oapiGetVesselCount(); i++)
-    {
-        const OBJHANDLE hVessel = oapiGetVesselByIndex(i);
+    VECTOR3 ourGlobalPos;
+    GetGlobalPos(ourGlobalPos);
 
-        /* NOTE: check should not be required! 
-        // If vessel deleted already, skip it!
-        if (oapiIsVessel(hVessel) == false)
-            continue;
-        */
+    // Note: these are returned in Orbiter's vessel order, so the list does not shuffle from one refresh to the next
+    static vector<const XRPayloadSpatialIndex::Item *> s_itemsInRange;  // reused across calls to avoid reallocation
+    XRPayloadSpatialIndex::GetInstance().FindVesselsInRange(ourGlobalPos, GetGrappleDisplayRange(), s_itemsInRange);
 
-        const VESSEL *pVessel = oapiGetVesselInterface(hVessel);
+    for (const XRPayloadSpatialIndex::Item *pItem : s_itemsInRange)
+    {
+        const OBJHANDLE hVessel = pItem->hVessel;
 
         // If vessel is *us*, skip it!
         if (hVessel == GetHandle())
             continue;
 
-        // check whether this vessel is in range
-        const double distance = GetDistanceToVessel(*pVessel);
-        if (distance <= range)
+        // vessel is in range and is an XR payload vessel; only show in list if vessel is NOT attached in the bay
+        if (m_pPayloadBay->IsChildVesselAttached(hVessel))
+            continue;
+
+        // The index may have been built earlier in this frame, before another vessel's PreStep deleted this vessel.
+        if (!oapiIsVessel(hVessel))
+            continue;
+
+        // Note: this SHOULD never be null here since we know the vessel exists at this point, but
+        // Orbiter tends to keep just-deleted vessels around for a frame afterward, so we have to handle that.
+        const VESSEL *pVessel = oapiGetVesselInterface(hVessel);
+        const XRGrappleTargetVessel *pGrappleTarget = GetGrappleTargetVessel(pVessel->GetName());
+        // WARNING: if two Orbiter vessels exist with the same name, bad things happen here because a second vessel can exist!
+        // I added code to prevent that from happening, but we still want to do defensive coding here.
+        if (pGrappleTarget != nullptr)
         {
-            // vessel is in range; only show in list if vessel is NOT attached in the bay
-            if (m_pPayloadBay->IsChildVesselAttached(hVessel) == false)
-            {
-                // vessel is in range and NOT attached in the bay: check whether it is an XR payload vessel
-                const XRPayloadClassData &pcd = XRPayloadClassData::GetXRPayloadClassDataForClassname(pVessel->GetClassName());
-                if (pcd.IsXRPayloadEnabled())
-                {
-                    // Note: this SHOULD never be null here since we know the vessel exists at this point, but
-                    // Orbiter tends to keep just-deleted vessels around for a frame afterward, so we have to handle that.
-                    const XRGrappleTargetVessel *pGrappleTarget = GetGrappleTargetVessel(pVessel->GetName());
-                    // WARNING: if two Orbiter vessels exist with the same name, bad things happen here because a second vessel can exist!
-                    // I added code to prevent that from happening, but we still want to do defensive coding here.
-                    if (pGrappleTarget != nullptr)
-                    {
-                        // add vessel to the payload-in-range list
-                        m_xrGrappleTargetVesselsInDisplayRange.push_back(pGrappleTarget);
-                    }
-                }
-            }
+            // add vessel to the payload-in-range list
+            m_xrGrappleTargetVesselsInDisplayRange.push_back(pGrappleTarget);
         }
     }
 }
@@ -288,10 +288,9 @@ bool DeltaGliderXR1::GetEngineState(XREngineID id, XREngineStateRead &state) con
             state.DivergentMode        = false;
 
             // read-only data
-            XR1Ramjet::THDEF *pThdef = ramjet->thdef[idx];    // SCRAMjet thruster definition data
             state.TSFC         = ramjet->TSFC(idx);
-            state.FlowRate     = pThdef->dmf;   // kg/sec
-            state.Thrust       = pThdef->F;
+            state.FlowRate     = ramjet->DMF(idx);   // kg/sec
+            state.Thrust       = ramjet->GetMostRecentThrust(idx);
             state.FuelLevel    = SAFE_FRACTION(GetXRPropellantMass(ph_scram), GetXRPropellantMaxMass(ph_scram));
             state.MaxFuelMass  = GetXRPropellantMaxMass(ph_scram);
             state.BayFuelMass  = GetXRBayPropellantMass(ph_scram);
@@ -1010,26 +1009,76 @@ bool DeltaGliderXR1::SetElevatorEVAPortActive(bool on)
 // Returns: # of lines copied to linesOut
 int DeltaGliderXR1::GetStatusScreenText(char *pLinesOut, const int maxLinesToRetrieve) const
 {
+    // This API has no buffer size parameter, so we hold the caller to the documented minimum of 50 bytes per line.
+    return BuildStatusScreenText(pLinesOut, 50 * maxLinesToRetrieve, maxLinesToRetrieve);
+}
+
+// Copy the newest lines on the status screen to pLinesOut, delimited by \r\n.
+//   bufferSize: size of pLinesOut in bytes, including the terminator; nothing is written past this.  If the lines do not fit, the last 
+//               line copied is truncated and no further lines are copied.
+// Returns: # of lines copied to pLinesOut, including any truncated line
+int DeltaGliderXR1::BuildStatusScreenText(char *pLinesOut, const int bufferSize, const int maxLinesToRetrieve) const
+{
+    if (bufferSize <= 0)
+        return 0;   // no room even for the terminator
+
     const int lineCount = m_infoWarningTextLineGroup.GetLineCount();
-    const int linesToRetrieve = min(maxLinesToRetrieve, lineCount);
+    const int linesToRetrieve = max(0, min(maxLinesToRetrieve, lineCount));
     const int startingLineIndex = lineCount - linesToRetrieve;
     _ASSERTE(startingLineIndex >= 0);
 
-    *pLinesOut = 0;  // empty contents
-
-    // NOTE: lines are stored from OLD -> NEW, so we always copy the newest 'linesToRetrieve' lines in the vector
-    for (int i=startingLineIndex; i < (startingLineIndex + linesToRetrieve); i++)
+    // NOTE: lines are stored from OLD -> NEW, so we always copy the newest 'linesToRetrieve' lines in the buffer
+    // We track the write position as we go, so each character is copied exactly once.
+    char *pOut = pLinesOut;
+    const char *pOutEnd = pLinesOut + bufferSize - 1;    // leave room for the terminator
+    int retVal = 0;
+    auto it = m_infoWarningTextLineGroup.GetLineIterator(startingLineIndex);
+    for (int i=0; (i < linesToRetrieve) && (pOut < pOutEnd); i++, ++it)
     {
-        _ASSERTE(i >= 0);
-        _ASSERTE(i < INFO_WARNING_BUFFER_LINES);
-        TextLine textLine = m_infoWarningTextLineGroup.GetLine(i);
-        
-        // retrieve each line's string object and copy it to pLinesOut by value and terminating each with \r\n
-        strcat(pLinesOut, textLine.text.c_str());
-        strcat(pLinesOut, "\r\n");
+        // copy each line's text to pLinesOut, terminating each with \r\n
+        const int copyLength = min(it->length, static_cast<int>(pOutEnd - pOut));
+        memcpy(pOut, it->text, copyLength);
+        pOut += copyLength;
+        retVal++;
+        if (copyLength < it->length)
+            break;  // buffer is full
+
+        if (pOut < pOutEnd)
+            *pOut++ = '\r';
+        if (pOut < pOutEnd)
+            *pOut++ = '\n';
     }
+    *pOut = 0;  // terminate the string
         
-    return linesToRetrieve;
+    return retVal;
+}
+
+// Same as GetStatusScreenText, except that nothing is copied if the status screen text has not changed since the caller's last retrieval.
+//   bufferSize: size of pLinesOut in bytes, including the terminator
+//   versionInOut: on entry, the version returned by the caller's previous call, or 0 for the first call; on exit, the version of the text now on the status screen
+// Returns: # of lines copied to pLinesOut, or -1 if the text is unchanged since versionInOut (pLinesOut is not modified)
+int DeltaGliderXR1::GetStatusScreenTextIfChanged(char *pLinesOut, const int bufferSize, const int maxLinesToRetrieve, int &versionInOut) const
+{
+    // the text changes each time lines are added or cleared; offset by one so that version 0 always retrieves the text
+    const int currentVersion = m_infoWarningTextLineGroup.GetAddLinesCount() + 1;
+    if (versionInOut == currentVersion)
+        return -1;  // text is unchanged
+
+    versionInOut = currentVersion;
+    return BuildStatusScreenText(pLinesOut, bufferSize, maxLinesToRetrieve);
+}
+
+// Writes PreStep/PostStep timing statistics to our log file on demand, in addition to the report written when the vessel is destroyed.
+// Returns: true if the report was written, false if XR_PREPOSTSTEP_PROFILER is not defined
+bool DeltaGliderXR1::LogPrePostStepProfile() const
+{
+#ifdef XR_PREPOSTSTEP_PROFILER
+    WritePrePostStepProfile();
+    GetXR1Config()->FlushLog();
+    return true;
+#else
+    return false;
+#endif
 }
 
 // Note: '&' character in the message string will generate a newline; tertiary HUD has approximately 38 characters per line.
@@ -32,40 +32,39 @@
 // size of a mesh group array
 #define SizeOfGrp(grp) (sizeof(grp) / sizeof(UINT))
 
-// Virtual Gateway method that decides which animations are valid for this vessel; if the incoming animation handle is valid, 
-// the call is propogated up to SetAnimation.  Otherwise, this method returns without changing the animation state.
-#define ALLOW(handlePtr)  if (&anim == &(handlePtr)) { SetAnimation(anim, state); return; }
-void XR2Ravenstar::SetXRAnimation(const UINT &anim, const double state) const
+// Register the animation handles that are valid for this vessel; invoked by BuildXRAnimationRegistry after DefineAnimations.
+// SetXRAnimation ignores any handle not registered here.
+void XR2Ravenstar::RegisterXRAnimations()
 {
-    ALLOW(anim_rcover);       // handle for retro cover animation
-    ALLOW(anim_hoverdoor);    // handle for hover doors animation
-    ALLOW(anim_scramdoor);    // handle for scram doors animation
-    ALLOW(anim_nose);         // handle for nose cone animation
-    ALLOW(anim_olock);        // handle for outer airlock animation
-    ALLOW(anim_ilock);        // handle for inner airlock animation
-    ALLOW(anim_hatch);        // handle for top hatch animation
-    ALLOW(anim_radiator);     // handle for radiator animation
-    ALLOW(anim_rudder);       // handle for rudder animation
-	ALLOW(anim_elevator);     // handle for elevator animation
-	ALLOW(anim_elevatortrim); // handle for elevator trim animation
-	ALLOW(anim_laileron);     // handle for left aileron animation
-	ALLOW(anim_raileron);     // handle for right aileron animation
-	ALLOW(anim_brake);        // handle for airbrake animation
-    ALLOW(anim_fuelhatch);    // handle for fuel hatch animation
-    ALLOW(anim_loxhatch);     // handle for LOX hatch animation
-    ALLOW(anim_gear);         // handle for landing gear animation
+    AllowXRAnimation(anim_rcover);       // handle for retro cover animation
+    AllowXRAnimation(anim_hoverdoor);    // handle for hover doors animation
+    AllowXRAnimation(anim_scramdoor);    // handle for scram doors animation
+    AllowXRAnimation(anim_nose);         // handle for nose cone animation
+    AllowXRAnimation(anim_olock);        // handle for outer airlock animation
+    AllowXRAnimation(anim_ilock);        // handle for inner airlock animation
+    AllowXRAnimation(anim_hatch);        // handle for top hatch animation
+    AllowXRAnimation(anim_radiator);     // handle for radiator animation
+    AllowXRAnimation(anim_rudder);       // handle for rudder animation
+	AllowXRAnimation(anim_elevator);     // handle for elevator animation
+	AllowXRAnimation(anim_elevatortrim); // handle for elevator trim animation
+	AllowXRAnimation(anim_laileron);     // handle for left aileron animation
+	AllowXRAnimation(anim_raileron);     // handle for right aileron animation
+	AllowXRAnimation(anim_brake);        // handle for airbrake animation
+    AllowXRAnimation(anim_fuelhatch);    // handle for fuel hatch animation
+    AllowXRAnimation(anim_loxhatch);     // handle for LOX hatch animation
+    AllowXRAnimation(anim_gear);         // handle for landing gear animation
 
     // New for XR2
-    ALLOW(anim_bay);          // handle for bay doors animation
-    ALLOW(m_animFrontTireRotation);
-    ALLOW(m_animRearTireRotation);
+    AllowXRAnimation(anim_bay);          // handle for bay doors animation
+    AllowXRAnimation(m_animFrontTireRotation);
+    AllowXRAnimation(m_animRearTireRotation);
     /* Not until the MK II
-    ALLOW(m_animNoseGearCompression);
-    ALLOW(m_animRearGearCompression);
+    AllowXRAnimation(m_animNoseGearCompression);
+    AllowXRAnimation(m_animRearGearCompression);
     */
 
-    // NO: ALLOW(m_animNosewheelSteering); 
-	// NO: ALLOW(anim_ladder);       // handle for front escape ladder animation
+    // NO: AllowXRAnimation(m_animNosewheelSteering); 
+	// NO: AllowXRAnimation(anim_ladder);       // handle for front escape ladder animation
 }
 
 // --------------------------------------------------------------
@@ -51,12 +51,20 @@
 // sets default values for memeber variables here
 XR2ConfigFileParser::XR2ConfigFileParser() :
     XR1ConfigFileParser(),
-    EnableHalloweenEasterEgg(true), ForceMarvinVisible(false),
+    PayloadScreensUpdateInterval(0.05), EnableHalloweenEasterEgg(true), ForceMarvinVisible(false),
     EnableFuzzyDice(false), EnableAFCtrlPerformanceModifier(false),
     RequirePayloadBayFuelTanks(0)
 {
     AFCtrlPerformanceModifier[0] = DEFAULT_AFCtrlPerformanceModifier_Pitch;  // Pitch
     AFCtrlPerformanceModifier[1] = DEFAULT_AFCtrlPerformanceModifier_On;     // On
+
+    // register XR2-specific properties; these override any XR1 properties with the same name
+    RegisterBool("GENERAL", "EnableAFCtrlPerformanceModifier", &EnableAFCtrlPerformanceModifier);
+    RegisterDouble("GENERAL", "PayloadScreensUpdateInterval", &PayloadScreensUpdateInterval, 0, 2.0, 0.05);
+    RegisterBool("GENERAL", "EnableHalloweenEasterEgg", &EnableHalloweenEasterEgg);   // UNDOCUMENTED switch to disable halloween easter egg
+    RegisterBool("GENERAL", "EnableFuzzyDice", &EnableFuzzyDice);
+    RegisterBool("GENERAL", "ForceMarvinVisible", &ForceMarvinVisible);
+    RegisterInt("GENERAL", "RequirePayloadBayFuelTanks", &RequirePayloadBayFuelTanks, 0, 2, 0);
 }
 
 // Parse a line; invoked by our superclass
@@ -75,40 +83,14 @@ bool XR2ConfigFileParser::ParseLine(const char *pSection, const char *pPropertyN
     // parse [GENERAL] settings
     if (SECTION_MATCHES("GENERAL"))
     {
-        if (PNAME_MATCHES("EnableAFCtrlPerformanceModifier"))
-        {
-            SSCANF_BOOL("%c", &EnableAFCtrlPerformanceModifier);
-        }
-        else if (PNAME_MATCHES("AFCtrlPerformanceModifier"))
+        // all other XR2 [GENERAL] settings are registered properties
+        if (PNAME_MATCHES("AFCtrlPerformanceModifier"))
         {
             // 1st value = "Pitch" modifier, 2nd value = "On" modifier
             SSCANF2("%lf %lf", AFCtrlPerformanceModifier, AFCtrlPerformanceModifier+1);
             VALIDATE_DOUBLE(AFCtrlPerformanceModifier,   0.2, 5.0, DEFAULT_AFCtrlPerformanceModifier_Pitch);
             VALIDATE_DOUBLE(AFCtrlPerformanceModifier+1, 0.2, 5.0, DEFAULT_AFCtrlPerformanceModifier_On);
         }
-        else if (PNAME_MATCHES("PayloadScreensUpdateInterval"))
-        {
-            SSCANF1("%lf", &PayloadScreensUpdateInterval);
-            VALIDATE_DOUBLE(&PayloadScreensUpdateInterval, 0, 2.0, 0.05);
-        }
-        // check for UNDOCUMENTED switch to disable halloween easter egg
-        else if (PNAME_MATCHES("EnableHalloweenEasterEgg"))
-        {
-			SSCANF_BOOL("%c", &EnableHalloweenEasterEgg);
-        }
-        else if (PNAME_MATCHES("EnableFuzzyDice"))
-        {
-			SSCANF_BOOL("%c", &EnableFuzzyDice);
-        }
-        else if (PNAME_MATCHES("ForceMarvinVisible"))
-        {
-			SSCANF_BOOL("%c", &ForceMarvinVisible);
-        }
-        else if (PNAME_MATCHES("RequirePayloadBayFuelTanks"))  // overrides XR1 base class parsing for this
-        {
-            SSCANF1("%d", &RequirePayloadBayFuelTanks);
-            VALIDATE_INT(&RequirePayloadBayFuelTanks, 0, 2, 0);
-        }
     }
     // no XR2-specific CHEATCODE items yet
 
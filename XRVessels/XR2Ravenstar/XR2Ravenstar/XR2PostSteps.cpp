@@ -32,52 +32,6 @@
 
 //---------------------------------------------------------------------------
 
-XR2AnimationPostStep::XR2AnimationPostStep(XR2Ravenstar &vessel) : 
-    XR2PrePostStep(vessel)
-{
-}
-
-void XR2AnimationPostStep::clbkPrePostStep(const double simt, const double simdt, const double mjd)
-{
-    // animate doors that require hydraulic pressure
-    if (GetXR2().CheckHydraulicPressure(false, false))     // do not log a warning nor play an error beep here!  We are merely querying the state.
-    {
-        AnimateBayDoors(simt, simdt, mjd);
-    }
-}
-
-void XR2AnimationPostStep::AnimateBayDoors(const double simt, const double simdt, const double mjd)
-{
-    // animate the payload bay doors
-    if (GetXR2().bay_status >= DoorStatus::DOOR_CLOSING)  // closing or opening
-    {
-        double da = simdt * BAY_OPERATING_SPEED;
-        if (GetXR2().bay_status == DoorStatus::DOOR_CLOSING)
-        {
-            if (GetXR2().bay_proc > 0.0)
-                GetXR2().bay_proc = max(0.0, GetXR2().bay_proc - da);
-            else
-            {
-                GetXR2().bay_status = DoorStatus::DOOR_CLOSED;
-                GetVessel().TriggerRedrawArea(AID_BAYDOORSINDICATOR);
-            }
-        } 
-        else    // door is opening or open
-        {
-            if (GetXR2().bay_proc < 1.0)
-                GetXR2().bay_proc = min (1.0, GetXR2().bay_proc + da);
-            else
-            {
-                GetXR2().bay_status = DoorStatus::DOOR_OPEN;
-                GetVessel().TriggerRedrawArea(AID_BAYDOORSINDICATOR);
-            }
-        }
-        GetXR2().SetXRAnimation(GetXR2().anim_bay, GetXR2().bay_proc);
-    }
-}
-
-//---------------------------------------------------------------------------
-
 XR2DoorSoundsPostStep::XR2DoorSoundsPostStep(XR2Ravenstar &vessel) : 
     DoorSoundsPostStep(vessel)
 {
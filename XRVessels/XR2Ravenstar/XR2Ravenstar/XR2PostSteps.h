@@ -34,18 +34,6 @@
 
 //---------------------------------------------------------------------------
 
-class XR2AnimationPostStep : public XR2PrePostStep
-{
-public:
-    XR2AnimationPostStep(XR2Ravenstar &vessel);
-    virtual void clbkPrePostStep(const double simt, const double simdt, const double mjd);
-
-protected:
-    void AnimateBayDoors  (const double simt, const double simdt, const double mjd);
-};
-
-//---------------------------------------------------------------------------
-
 // handles door opening/closing sounds
 class XR2DoorSoundsPostStep : public DoorSoundsPostStep
 {
@@ -35,6 +35,7 @@
 #include "XR2InstrumentPanels.h"
 #include "XR2Globals.h"
 #include "XRPayload.h"
+#include "FileCacheWarmer.h"
 #include "XR2PayloadBay.h"
 // TODO: #include "XR2PayloadDialog.h"
 
@@ -59,6 +60,7 @@ DLLCLBK void ExitModule (HINSTANCE hModule)
 {
     oapiUnregisterCustomControls(hModule);
     XRPayloadClassData::Terminate();     // clean up global cache
+    FileCacheWarmer::Terminate();        // stop warming sound files
 }
 
 // --------------------------------------------------------------
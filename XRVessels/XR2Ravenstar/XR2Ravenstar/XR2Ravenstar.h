@@ -66,10 +66,10 @@ public:
     virtual int  clbkConsumeBufferedKey(DWORD key, bool down, char *kstate);
     virtual bool clbkLoadGenericCockpit();
     virtual void clbkADCtrlMode(DWORD mode);
-    virtual bool clbkPanelRedrawEvent(int areaID, int event, SURFHANDLE surf);
 
     // overridden superclass methods
-    virtual void SetXRAnimation(const UINT &anim, const double state) const;
+    virtual double GetPanelRedrawInterval(const int areaID) const;
+    virtual void RegisterXRAnimations();
     virtual void DefineAnimations();
     virtual void CleanUpAnimations();
     virtual void TweakInternalValue(bool direction);  // used for developement testing only; usually an empty method
@@ -89,6 +89,7 @@ public:
 
     // convenience method
     XR2ConfigFileParser *GetXR2Config() { return static_cast<XR2ConfigFileParser *>(m_pConfig);  }
+    const XR2ConfigFileParser *GetXR2Config() const { return static_cast<const XR2ConfigFileParser *>(m_pConfig);  }
 
     // payload methods
     void ResetCameraToPayloadBay();
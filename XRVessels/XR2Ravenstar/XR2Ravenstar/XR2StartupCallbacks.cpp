@@ -52,6 +52,7 @@ void XR2Ravenstar::clbkSetClassCaps(FILEHANDLE cfg)
 
     // Note: this must be invoked here instead of the constructor so the subclass may override it!
     DefineAnimations();
+    BuildXRAnimationRegistry();   // must follow DefineAnimations
 
     // define our payload bay and attachment points
     CreatePayloadBay();
@@ -796,7 +797,7 @@ void XR2Ravenstar::clbkPostCreation()
     clbkPostCreationCommonXRCode();
 
     // Initialize XR payload vessel data
-    XRPayloadClassData::InitializeXRPayloadClassData();
+    XRPayloadClassData::InitializeXRPayloadClassData(GetXR1Config());   // scan statistics are written to our log
 
     ApplyElevatorAreaChanges();   // apply "dual-mode" AF Ctrl elevator settings
     EnableRetroThrusters(rcover_status == DoorStatus::DOOR_OPEN);
@@ -859,8 +860,9 @@ void XR2Ravenstar::clbkPostCreation()
     AddPostStep(new UpdateMassPostStep(*this));
 
     AddPostStep(new SwitchTwoDPanelPostStep(*this));
-    AddPostStep(new AnimationPostStep(*this));  // Note: this should be BEFORE XR2AnimationPostStep so the gear animates correctly
-    AddPostStep(new XR2AnimationPostStep(*this));
+    AnimationPostStep *pAnimationPostStep = new AnimationPostStep(*this);
+    pAnimationPostStep->AddDoor(bay_status, bay_proc, BAY_OPERATING_SPEED, &anim_bay, AID_BAYDOORSINDICATOR);
+    AddPostStep(pAnimationPostStep);
     AddPostStep(new XR2DoorSoundsPostStep(*this));
 
     AddPostStep(new OneShotInitializationPostStep(*this));
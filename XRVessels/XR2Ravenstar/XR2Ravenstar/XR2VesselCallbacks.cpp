@@ -76,6 +76,7 @@ void XR2Ravenstar::clbkVisualCreated(VISHANDLE vis, int refcount)
     // performed by the XR1 base class are XR1-mesh-specific.
 
     heatingmesh = GetDevMesh(vis, 1);  // hull heating mesh; the single group in this mesh is HIDDEN by default
+    m_heatingMeshVersion++;            // so SetHullTempsPostStep resends its state to the new instance
 
     SetPassengerVisuals();
     SetDamageVisuals();
@@ -140,48 +141,24 @@ void XR2Ravenstar::clbkVisualDestroyed(VISHANDLE vis, int refcount)
     // Note: vcmesh remains nullptr at all times with the XR2
 }
 
-// override clbkPanelRedrawEvent so we can limit our refresh rates for our custom screens
-bool XR2Ravenstar::clbkPanelRedrawEvent(int areaID, int event, SURFHANDLE surf)
+// override GetPanelRedrawInterval so we can set our refresh rates for our custom screens
+double XR2Ravenstar::GetPanelRedrawInterval(const int areaID) const
 {
-    const XR2ConfigFileParser* pConfig = GetXR2Config();
-
-    // Only filter PANEL_REDRAW_ALWAYS events for timing!
-    if (event == PANEL_REDRAW_ALWAYS)
+    double retVal;
+    switch (areaID)
     {
-        // NOTE: we want to check *realtime* deltas, not *simulation time* here: repaint frequency should not
-        // vary based on time acceleration.
-        const double uptime = GetSystemUptime();  // will always count up
-
-        // check for area IDs that have custom refresh rates
-        int screenIndex = 0;  // for payload screens
-        switch (areaID)
-        {
-        case AID_SELECT_PAYLOAD_BAY_SLOT_SCREEN:
-            goto check;     // 0
-
-        case AID_GRAPPLE_PAYLOAD_SCREEN:
-            screenIndex = 1;
-            goto check;
-
-        case AID_DEPLOY_PAYLOAD_SCREEN:
-            screenIndex = 2;
-        check:
-            if (uptime < m_nextPayloadScreensRefresh[screenIndex])
-                return false;
-
-            // update for next interval
-            m_nextPayloadScreensRefresh[screenIndex] = uptime + pConfig->PayloadScreensUpdateInterval;
-
-            // force the repaint to occur by invoking the VESSEL3 superclass directly; otherwise the XR1 impl would 
-            // see each of these areas as just another area and limit it by PanelUpdateInterval yet, which we want to bypass.
-            return VESSEL3_EXT::clbkPanelRedrawEvent(areaID, event, surf);
-
-            // no default case here; fall through
-        }
+    case AID_SELECT_PAYLOAD_BAY_SLOT_SCREEN:
+    case AID_GRAPPLE_PAYLOAD_SCREEN:
+    case AID_DEPLOY_PAYLOAD_SCREEN:
+        retVal = GetXR2Config()->PayloadScreensUpdateInterval;
+        break;
+
+    default:
+        retVal = DeltaGliderXR1::GetPanelRedrawInterval(areaID);
+        break;
     }
 
-    // redraw is OK: invoke the superclass to dispatch the redraw event
-    return DeltaGliderXR1::clbkPanelRedrawEvent(areaID, event, surf);
+    return retVal;
 }
 
 // --------------------------------------------------------------
@@ -31,37 +31,36 @@
 #include "meshres.h"
 
 
-// Virtual Gateway method that decides which animations are valid for this vessel; if the incoming animation handle is valid, 
-// the call is propogated up to SetAnimation.  Otherwise, this method returns without changing the animation state.
-#define ALLOW(handlePtr)  if (&anim == &(handlePtr)) { SetAnimation(anim, state); return; }
-void XR3Phoenix::SetXRAnimation(const UINT &anim, const double state) const
+// Register the animation handles that are valid for this vessel; invoked by BuildXRAnimationRegistry after DefineAnimations.
+// SetXRAnimation ignores any handle not registered here.
+void XR3Phoenix::RegisterXRAnimations()
 {
     // TODO: enable these as they are added to the XR3 code
 #if 0
-    ALLOW(anim_gear);         // handle for landing gear animation
-	ALLOW(anim_rcover);       // handle for retro cover animation
-    ALLOW(anim_hoverdoor);    // handle for hover doors animation
-    ALLOW(anim_scramdoor);    // handle for scram doors animation
-	ALLOW(anim_nose);         // handle for docking port animation
-	ALLOW(anim_hatch);        // handle for top hatch animation 
-	ALLOW(anim_radiator);     // handle for radiator animation
-	ALLOW(anim_rudder);       // handle for rudder animation
-	ALLOW(anim_elevator);     // handle for elevator animation
-	ALLOW(anim_elevatortrim); // handle for elevator trim animation
-	ALLOW(anim_laileron);     // handle for left aileron animation
-	ALLOW(anim_raileron);     // handle for right aileron animation
-	ALLOW(anim_brake);        // handle for airbrake animation
-    ALLOW(anim_olock);        // handle for outer airlock door animation
-    ALLOW(anim_ilock);        // handle for inner airlock door animation
+    AllowXRAnimation(anim_gear);         // handle for landing gear animation
+	AllowXRAnimation(anim_rcover);       // handle for retro cover animation
+    AllowXRAnimation(anim_hoverdoor);    // handle for hover doors animation
+    AllowXRAnimation(anim_scramdoor);    // handle for scram doors animation
+	AllowXRAnimation(anim_nose);         // handle for docking port animation
+	AllowXRAnimation(anim_hatch);        // handle for top hatch animation 
+	AllowXRAnimation(anim_radiator);     // handle for radiator animation
+	AllowXRAnimation(anim_rudder);       // handle for rudder animation
+	AllowXRAnimation(anim_elevator);     // handle for elevator animation
+	AllowXRAnimation(anim_elevatortrim); // handle for elevator trim animation
+	AllowXRAnimation(anim_laileron);     // handle for left aileron animation
+	AllowXRAnimation(anim_raileron);     // handle for right aileron animation
+	AllowXRAnimation(anim_brake);        // handle for airbrake animation
+    AllowXRAnimation(anim_olock);        // handle for outer airlock door animation
+    AllowXRAnimation(anim_ilock);        // handle for inner airlock door animation
 
     // new for XR3
-    ALLOW(anim_crewElevator);
-    ALLOW(anim_bay);
-    ALLOW(m_animNoseGearCompression);
-    ALLOW(m_animRearGearCompression);
-    ALLOW(m_animFrontTireRotation);
-    ALLOW(m_animRearTireRotation);
-    ALLOW(m_animNosewheelSteering);
+    AllowXRAnimation(anim_crewElevator);
+    AllowXRAnimation(anim_bay);
+    AllowXRAnimation(m_animNoseGearCompression);
+    AllowXRAnimation(m_animRearGearCompression);
+    AllowXRAnimation(m_animFrontTireRotation);
+    AllowXRAnimation(m_animRearTireRotation);
+    AllowXRAnimation(m_animNosewheelSteering);
 #endif
 }
 
@@ -34,6 +34,7 @@
 #include "XR3AreaIDs.h" 
 #include "XR3Globals.h"
 #include "XRPayload.h"
+#include "FileCacheWarmer.h"
 #include "XR3PayloadBay.h"
 
 #include "meshres.h"
@@ -58,6 +59,7 @@ DLLCLBK void ExitModule (HINSTANCE hModule)
 {
     oapiUnregisterCustomControls(hModule);
     XRPayloadClassData::Terminate();     // clean up global cache
+    FileCacheWarmer::Terminate();        // stop warming sound files
 }
 
 // --------------------------------------------------------------
@@ -56,8 +56,8 @@ public:
     virtual void clbkSaveState (FILEHANDLE scn);
     virtual int clbkConsumeDirectKey (char *kstate);
     virtual int clbkConsumeBufferedKey(DWORD key, bool down, char *kstate);
-    virtual bool clbkPanelRedrawEvent(int areaID, int event, SURFHANDLE surf);
     virtual bool clbkLoadGenericCockpit();
+    virtual double GetPanelRedrawInterval(const int areaID) const;
 
     virtual void UpdateCtrlDialog(XR3Phoenix *dg, HWND hWnd = nullptr);
     virtual void DefineAnimations();
@@ -96,6 +96,7 @@ public:
 
     // convenience method
     XR3ConfigFileParser *GetXR3Config() { return static_cast<XR3ConfigFileParser *>(m_pConfig);  }
+    const XR3ConfigFileParser *GetXR3Config() const { return static_cast<const XR3ConfigFileParser *>(m_pConfig);  }
 
     // new methods
     bool SetRCSDockingMode(bool dockingMode);
@@ -107,10 +108,7 @@ public:
     void CreatePayloadBay();
     void SetActiveEVAPort(ACTIVE_EVA_PORT newState);
 
-    // WARNING: All code should invoke SetXRAnimation instead of SetXRAnimation!  The reason is that 
-    // SetXRAnimation always assumes that the handle is valid, and so SetXRAnimation is a virtual "gateway" 
-    // method that allows each subclass to determine whether that animation is valid or not for that vessel.
-    virtual void SetXRAnimation(const UINT &anim, const double state) const;
+    virtual void RegisterXRAnimations();
 
     // mesh indicies
     UINT m_exteriorMeshIndex;
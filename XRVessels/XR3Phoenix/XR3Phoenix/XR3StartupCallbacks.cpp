@@ -26,6 +26,7 @@
 #include "XR3Phoenix.h"
 
 #include "XR3InstrumentPanels.h"
+#include "XR3AreaIDs.h"
 #include "XR1PreSteps.h"
 #include "XR1PostSteps.h"
 #include "XR1FuelPostSteps.h"
@@ -51,6 +52,7 @@ void XR3Phoenix::clbkSetClassCaps(FILEHANDLE cfg)
 
     // Note: this must be invoked here instead of the constructor so the we may override it!
     DefineAnimations();
+    BuildXRAnimationRegistry();   // must follow DefineAnimations
 
     // define our payload bay and attachment points
     CreatePayloadBay();
@@ -656,7 +658,7 @@ void XR3Phoenix::clbkPostCreation()
     ConfigureRCSJets(m_rcsDockingMode);
 
     // Initialize XR payload vessel data
-    XRPayloadClassData::InitializeXRPayloadClassData();
+    XRPayloadClassData::InitializeXRPayloadClassData(GetXR1Config());   // scan statistics are written to our log
 
     DefineMmuAirlock();    // update UMmu airlock data based on current active EVA port
 
@@ -718,7 +720,13 @@ void XR3Phoenix::clbkPostCreation()
     AddPostStep(new UpdateMassPostStep(*this));
     AddPostStep(new DisableControlSurfForAPUPostStep(*this));
     AddPostStep(new OneShotInitializationPostStep(*this));
-    AddPostStep(new AnimationPostStep(*this));
+
+    // custom doors are animated by the standard AnimationPostStep
+    AnimationPostStep *pAnimationPostStep = new AnimationPostStep(*this);
+    pAnimationPostStep->AddDoor(bay_status, bay_proc, BAY_OPERATING_SPEED, &anim_bay, AID_BAYDOORSINDICATOR);
+    pAnimationPostStep->AddDoor(crewElevator_status, crewElevator_proc, ELEVATOR_OPERATING_SPEED, &anim_crewElevator, AID_ELEVATORINDICATOR);
+    AddPostStep(pAnimationPostStep);
+
     AddPostStep(new FuelDumpPostStep(*this));
     AddPostStep(new XFeedPostStep(*this));
     AddPostStep(new ResupplyPostStep(*this));
@@ -731,7 +739,6 @@ void XR3Phoenix::clbkPostCreation()
 
     // NEW poststeps specific to the XR3
     AddPostStep(new SwitchTwoDPanelPostStep(*this));
-    AddPostStep(new XR3AnimationPostStep(*this));
     AddPostStep(new XR3DoorSoundsPostStep(*this));  // replaces the standard DoorSoundsPostStep in the XR1 class
     AddPostStep(new HandleDockChangesForActiveAirlockPostStep(*this));  // switch active airlock automatically as necessary
 
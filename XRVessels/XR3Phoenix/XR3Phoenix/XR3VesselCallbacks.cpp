@@ -113,44 +113,22 @@ void XR3Phoenix::clbkNavMode(int mode, bool active)
     DeltaGliderXR1::clbkNavMode(mode, active);
 }
 
-// override clbkPanelRedrawEvent so we can limit our refresh rates for our custom screens
-bool XR3Phoenix::clbkPanelRedrawEvent(int areaID, int event, SURFHANDLE surf)
+// override GetPanelRedrawInterval so we can set our refresh rates for our custom screens
+double XR3Phoenix::GetPanelRedrawInterval(const int areaID) const
 {
-    const XR3ConfigFileParser* pConfig = GetXR3Config();
-
-    // Only filter PANEL_REDRAW_ALWAYS events for timing!
-    if (event == PANEL_REDRAW_ALWAYS)
+    double retVal;
+    switch (areaID)
     {
-        // NOTE: we want to check *realtime* deltas, not *simulation time* here: repaint frequency should not
-        // vary based on time acceleration.
-        const double uptime = GetSystemUptime();  // will always count up
-
-        // check for area IDs that have custom refresh rates
-        int screenIndex = 0;  // for payload screens
-        switch (areaID)
-        {
-        case AID_SELECT_PAYLOAD_BAY_SLOT_SCREEN:
-            goto check;     // 0
-
-        case AID_GRAPPLE_PAYLOAD_SCREEN:
-            screenIndex = 1;
-            goto check;
-
-        case AID_DEPLOY_PAYLOAD_SCREEN:
-            screenIndex = 2;
-        check:
-            if (uptime < m_nextPayloadScreensRefresh[screenIndex])
-                return false;
-
-            // update for next interval
-            m_nextPayloadScreensRefresh[screenIndex] = uptime + pConfig->PayloadScreensUpdateInterval;
-
-            // force the repaint to occur by invoking the VESSEL3 superclass directly; otherwise the XR1 impl would 
-            // see each of these areas as just another area and limit it by PanelUpdateInterval yet, which we want to bypass.
-            return VESSEL3_EXT::clbkPanelRedrawEvent(areaID, event, surf);
-        }
+    case AID_SELECT_PAYLOAD_BAY_SLOT_SCREEN:
+    case AID_GRAPPLE_PAYLOAD_SCREEN:
+    case AID_DEPLOY_PAYLOAD_SCREEN:
+        retVal = GetXR3Config()->PayloadScreensUpdateInterval;
+        break;
+
+    default:
+        retVal = DeltaGliderXR1::GetPanelRedrawInterval(areaID);
+        break;
     }
 
-    // redraw is OK: invoke the superclass to dispatch the redraw event
-    return DeltaGliderXR1::clbkPanelRedrawEvent(areaID, event, surf);
+    return retVal;
 }
@@ -63,15 +63,7 @@ bool XR5ConfigFileParser::ParseLine(const char *pSection, const char *pPropertyN
     // Note: 'processed' is set by the parsing macros, so we do not need to set it manually below
 
     // parse [GENERAL] settings
-    if (SECTION_MATCHES("GENERAL"))
-    {
-        if (PNAME_MATCHES("PayloadScreensUpdateInterval"))
-        {
-            SSCANF1("%lf", &PayloadScreensUpdateInterval);
-            VALIDATE_DOUBLE(&PayloadScreensUpdateInterval, 0, 2.0, 0.05);
-        }
-
-    }
+    // Note: PayloadScreensUpdateInterval is a registered XR1 property; nothing custom for now.
     
     // parse [CHEATCODES] settings
     
@@ -34,19 +34,6 @@
 
 //---------------------------------------------------------------------------
 
-class XR5AnimationPostStep : public XR5PrePostStep
-{
-public:
-    XR5AnimationPostStep(XR5Vanguard &vessel);
-    virtual void clbkPrePostStep(const double simt, const double simdt, const double mjd);
-
-protected:
-    void AnimateBayDoors    (const double simt, const double simdt, const double mjd);
-    void AnimateElevator    (const double simt, const double simdt, const double mjd);
-};
-
-//---------------------------------------------------------------------------
-
 // handles door opening/closing sounds
 class XR5DoorSoundsPostStep : public DoorSoundsPostStep
 {
@@ -28,6 +28,7 @@
 #include "XR5Vanguard.h"
 
 #include "XR5InstrumentPanels.h"
+#include "XR5AreaIDs.h"
 #include "XR1PreSteps.h"
 #include "XR1PostSteps.h"
 #include "XR1FuelPostSteps.h"
@@ -51,6 +52,7 @@ void XR5Vanguard::clbkSetClassCaps(FILEHANDLE cfg)
 
     // Note: this must be invoked here instead of the constructor so the we may override it!
     DefineAnimations();
+    BuildXRAnimationRegistry();   // must follow DefineAnimations
 
     // define our payload bay and attachment points
     CreatePayloadBay();
@@ -638,7 +640,7 @@ void XR5Vanguard::clbkPostCreation()
     ConfigureRCSJets(m_rcsDockingMode);
 
     // Initialize XR payload vessel data
-    XRPayloadClassData::InitializeXRPayloadClassData();
+    XRPayloadClassData::InitializeXRPayloadClassData(GetXR1Config());   // scan statistics are written to our log
 
     DefineMmuAirlock();    // update Mmu airlock data based on current active EVA port
 
@@ -700,7 +702,13 @@ void XR5Vanguard::clbkPostCreation()
     AddPostStep(new UpdateMassPostStep(*this));
     AddPostStep(new DisableControlSurfForAPUPostStep(*this));
     AddPostStep(new OneShotInitializationPostStep(*this));
-    AddPostStep(new AnimationPostStep(*this));
+
+    // custom doors are animated by the standard AnimationPostStep
+    AnimationPostStep *pAnimationPostStep = new AnimationPostStep(*this);
+    pAnimationPostStep->AddDoor(bay_status, bay_proc, BAY_OPERATING_SPEED, &anim_bay, AID_BAYDOORSINDICATOR);
+    pAnimationPostStep->AddDoor(crewElevator_status, crewElevator_proc, ELEVATOR_OPERATING_SPEED, &anim_crewElevator, AID_ELEVATORINDICATOR);
+    AddPostStep(pAnimationPostStep);
+
     AddPostStep(new FuelDumpPostStep(*this));
     AddPostStep(new XFeedPostStep(*this));
     AddPostStep(new ResupplyPostStep(*this));
@@ -713,7 +721,6 @@ void XR5Vanguard::clbkPostCreation()
 
     // NEW poststeps specific to the XR5
     AddPostStep(new SwitchTwoDPanelPostStep(*this));
-    AddPostStep(new XR5AnimationPostStep(*this));
     AddPostStep(new XR5DoorSoundsPostStep(*this));  // replaces the standard DoorSoundsPostStep in the XR1 class
     AddPostStep(new HandleDockChangesForActiveAirlockPostStep(*this));  // switch active airlock automatically as necessary
 
@@ -33,6 +33,7 @@
 
 #include "XR5AreaIDs.h"  
 #include "XR5Globals.h"
+#include "FileCacheWarmer.h"
 
 #include "meshres.h"
 
@@ -56,6 +57,7 @@ DLLCLBK void ExitModule (HINSTANCE hModule)
 {
     oapiUnregisterCustomControls(hModule);
     XRPayloadClassData::Terminate();     // clean up global cache
+    FileCacheWarmer::Terminate();        // stop warming sound files
 }
 
 // --------------------------------------------------------------
@@ -29,7 +29,8 @@
 #include "Area.h"
 
 // Constructor
-AreaGroup::AreaGroup()
+AreaGroup::AreaGroup() :
+    m_areaTableBaseID(0)
 {
 }
 
@@ -52,7 +53,27 @@ Area *AreaGroup::AddArea(Area *pArea)
 {
     typedef pair<int, Area *> Int_Area_Pair;
     int areaID = pArea->GetAreaID();
-    m_areaMap.insert(Int_Area_Pair(areaID, pArea));  // key = area ID, value = Area *
+    const bool isNewArea = m_areaMap.insert(Int_Area_Pair(areaID, pArea)).second;  // key = area ID, value = Area *
+
+    // Mirror the area in the dense lookup table; on a duplicate area ID the map keeps the original area, so the table does as well.
+    // Area IDs within a group are clustered, so the table only spans the lowest through the highest ID in this group.
+    if (isNewArea)
+    {
+        if (m_areaTable.empty())
+        {
+            m_areaTableBaseID = areaID;
+        }
+        else if (areaID < m_areaTableBaseID)
+        {
+            m_areaTable.insert(m_areaTable.begin(), m_areaTableBaseID - areaID, nullptr);
+            m_areaTableBaseID = areaID;
+        }
+
+        const int index = areaID - m_areaTableBaseID;
+        if (index >= static_cast<int>(m_areaTable.size()))
+            m_areaTable.resize(index + 1, nullptr);
+        m_areaTable[index] = pArea;
+    }
 
     return pArea;
 }
@@ -83,11 +104,12 @@ void AreaGroup::DeactivateAllAreas()
 // Returns: Area object if found, or nullptr if area with the supplied ID does not exist in this area group
 Area *AreaGroup::GetArea(const int areaID)
 {
+    // This is invoked for every mouse and redraw event, so use the dense table instead of hashing
     Area *retVal = nullptr;    // assume not found
-    unordered_map<int, Area *>::const_iterator it = m_areaMap.find(areaID);
+    const int index = areaID - m_areaTableBaseID;
     
-    if (it != m_areaMap.end())
-        retVal = it->second;     // found a matching area
+    if ((index >= 0) && (index < static_cast<int>(m_areaTable.size())))
+        retVal = m_areaTable[index];     // nullptr if no area with this ID
 
     return retVal;
 }
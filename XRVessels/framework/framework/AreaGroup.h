@@ -29,6 +29,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
 using namespace std;
 using namespace stdext;
@@ -55,4 +56,6 @@ public:
 private:
     // data
     unordered_map<int, Area *> m_areaMap;    // map of all areas in this group: key = area ID, value = Area *
+    vector<Area *> m_areaTable;              // dense lookup table for GetArea: index = area ID - m_areaTableBaseID, value = Area * or nullptr
+    int m_areaTableBaseID;                   // area ID of m_areaTable[0]
 };
@@ -0,0 +1,232 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+// ==============================================================
+// AsyncLogWriter.cpp
+// Writes log messages to a file on a background thread.
+//
+// The queue is a bounded multi-producer queue (Dmitry Vyukov's design):
+// each slot carries a sequence number, so producers claim slots with a
+// single compare-and-swap and never block.  Only one thread drains the
+// queue at a time.
+//
+// Messages sit in the queue for up to WRITE_INTERVAL_MS.  We do not hook
+// process-wide crash handlers from here: this is a static library linked
+// into each vessel DLL, and any of those DLLs may be unloaded.  Instead,
+// the fatal error path and our destructor flush the queue synchronously.
+// ==============================================================
+
+#include "AsyncLogWriter.h"
+
+#include <ctype.h>
+
+mutex AsyncLogWriter::s_registryMutex;
+unordered_map<string, weak_ptr<AsyncLogWriter>> AsyncLogWriter::s_writers;
+
+// Returns the writer for the specified log file, opening the file in APPEND mode if no other caller has it open.
+// All ship instances logging to the same file share one writer, and so one queue and one writer thread.
+// pFilename = path to log file; may be null, in which case all messages are discarded
+// Returns: never null; check IsEnabled() to see whether the file could be opened
+shared_ptr<AsyncLogWriter> AsyncLogWriter::Open(const char *pFilename)
+{
+    if (pFilename == nullptr)
+        return shared_ptr<AsyncLogWriter>(new AsyncLogWriter(nullptr));    // logging disabled
+
+    // Windows filenames are case-insensitive
+    string key(pFilename);
+    for (char &c : key)
+        c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+
+    lock_guard<mutex> lock(s_registryMutex);
+    shared_ptr<AsyncLogWriter> retVal = s_writers[key].lock();
+    if (retVal == nullptr)
+    {
+        FILE *pFile = fopen(pFilename, "a+t");
+        if (pFile == nullptr)
+        {
+            s_writers.erase(key);   // so the next caller tries again
+            return shared_ptr<AsyncLogWriter>(new AsyncLogWriter(nullptr));
+        }
+
+        retVal = shared_ptr<AsyncLogWriter>(new AsyncLogWriter(pFile));
+        retVal->m_registryKey = key;
+        s_writers[key] = retVal;
+    }
+    return retVal;
+}
+
+// Constructor
+// pFile = open log file; may be null, in which case all messages are discarded.  We take ownership of the file.
+AsyncLogWriter::AsyncLogWriter(FILE *pFile) :
+    m_pFile(pFile), m_enqueuePos(0), m_dequeuePos(0), m_stopRequested(false),
+    m_writtenCount(0), m_droppedCount(0), m_reportedDroppedCount(0)
+{
+    m_pSlots = new Slot[QUEUE_SIZE];
+    for (size_t i = 0; i < QUEUE_SIZE; i++)
+        m_pSlots[i].sequence.store(i, memory_order_relaxed);
+
+    m_hWakeEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);  // auto-reset
+    if (m_pFile != nullptr)
+        m_writerThread = thread(&AsyncLogWriter::WriterThread, this);
+}
+
+// Destructor: stops the writer thread and writes any remaining messages
+AsyncLogWriter::~AsyncLogWriter()
+{
+    m_stopRequested = true;
+    if (m_writerThread.joinable())
+    {
+        SetEvent(m_hWakeEvent);
+        m_writerThread.join();
+    }
+    Flush();
+
+    if (m_pFile != nullptr)
+    {
+        fclose(m_pFile);
+
+        lock_guard<mutex> lock(s_registryMutex);
+        // another caller may have reopened this file after our last reference went away, so only remove our own expired entry
+        const auto it = s_writers.find(m_registryKey);
+        if ((it != s_writers.end()) && it->second.expired())
+            s_writers.erase(it);
+    }
+
+    CloseHandle(m_hWakeEvent);
+    delete[] m_pSlots;
+}
+
+// Format and queue a message; this never blocks and never touches the disk.
+// pPrefix = formatted log prefix, e.g., "[XR2-01] "; may be empty but not null
+// Returns: true if the message was queued, false if it was dropped because the queue is full
+bool AsyncLogWriter::Write(const char *pPrefix, const char *pMsg)
+{
+    if (m_pFile == nullptr)
+        return false;   // logging disabled
+
+    // claim a slot
+    size_t pos = m_enqueuePos.load(memory_order_relaxed);
+    Slot *pSlot;
+    for (;;)
+    {
+        pSlot = m_pSlots + (pos & (QUEUE_SIZE - 1));
+        const size_t seq = pSlot->sequence.load(memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0)
+        {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                break;  // slot is ours
+        }
+        else if (diff < 0)
+        {
+            // queue is full: drop the message and wake the writer
+            m_droppedCount++;
+            SetEvent(m_hWakeEvent);
+            return false;
+        }
+        else
+            pos = m_enqueuePos.load(memory_order_relaxed);  // another thread claimed this slot; try again
+    }
+
+    // format the message with a timestamp here so it reflects when the message was logged, not when it was written
+    SYSTEMTIME st;
+    GetLocalTime(&st);
+    int len = _snprintf(pSlot->text, MAX_MESSAGE_LENGTH - 1, "%02d.%02d.%04d %02d:%02d:%02d.%03d - %s%s\n",
+        st.wMonth, st.wDay, st.wYear,
+        st.wHour, st.wMinute, st.wSecond, st.wMilliseconds,
+        pPrefix, pMsg);
+    if ((len < 0) || (len >= MAX_MESSAGE_LENGTH - 1))
+    {
+        // message was truncated: end it with a newline
+        len = MAX_MESSAGE_LENGTH - 1;
+        pSlot->text[len - 1] = '\n';
+    }
+    pSlot->text[len] = 0;
+    pSlot->length = len;
+
+    // publish the slot to the writer
+    pSlot->sequence.store(pos + 1, memory_order_release);
+
+    // don't make a kernel call for every message: the writer wakes up on its own every WRITE_INTERVAL_MS
+    if ((pos & ((QUEUE_SIZE / 2) - 1)) == 0)
+        SetEvent(m_hWakeEvent);
+
+    return true;
+}
+
+// Synchronously write all queued messages to disk; invoke this before terminating the process
+void AsyncLogWriter::Flush()
+{
+    Drain();
+}
+
+// Background thread: drain the queue every WRITE_INTERVAL_MS or whenever we are signaled
+void AsyncLogWriter::WriterThread()
+{
+    while (m_stopRequested == false)
+    {
+        WaitForSingleObject(m_hWakeEvent, WRITE_INTERVAL_MS);
+        Drain();
+    }
+}
+
+// Write all queued messages to the file, followed by a single flush.
+// Returns: number of messages written
+int AsyncLogWriter::Drain()
+{
+    if (m_pFile == nullptr)
+        return 0;   // logging disabled
+
+    lock_guard<mutex> lock(m_drainMutex);
+
+    int retVal = 0;
+    for (;;)
+    {
+        Slot &slot = m_pSlots[m_dequeuePos & (QUEUE_SIZE - 1)];
+        const size_t seq = slot.sequence.load(memory_order_acquire);
+        if (seq != m_dequeuePos + 1)
+            break;  // slot not published yet, so the queue is empty
+
+        OutputDebugString(slot.text);   // send to debug console
+        fwrite(slot.text, 1, slot.length, m_pFile);
+
+        // release the slot for reuse by producers
+        slot.sequence.store(m_dequeuePos + QUEUE_SIZE, memory_order_release);
+        m_dequeuePos++;
+        retVal++;
+    }
+
+    // note any dropped messages in the log itself
+    bool bReportedDrops = false;
+    const unsigned __int64 droppedCount = m_droppedCount;
+    if (droppedCount != m_reportedDroppedCount)
+    {
+        fprintf(m_pFile, "*** WARNING: %I64u log message(s) dropped because the log queue was full\n", droppedCount - m_reportedDroppedCount);
+        m_reportedDroppedCount = droppedCount;
+        bReportedDrops = true;
+    }
+
+    m_writtenCount += retVal;
+    if ((retVal > 0) || bReportedDrops)
+        fflush(m_pFile);    // once per batch, not once per message
+
+    return retVal;
+}
@@ -0,0 +1,92 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+// ==============================================================
+// AsyncLogWriter.h
+// Writes log messages to a file on a background thread.  Callers
+// format each message into a slot of a bounded lock-free queue, and
+// the writer thread drains the queue in batches with a single fflush
+// per batch.  If the queue is full the message is dropped and counted.
+// One writer is shared by all callers that log to the same file.
+// ==============================================================
+
+#pragma once
+
+#include <Windows.h>
+#include <stdio.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+using namespace std;
+
+class AsyncLogWriter
+{
+public:
+    static shared_ptr<AsyncLogWriter> Open(const char *pFilename);
+    virtual ~AsyncLogWriter();
+
+    bool Write(const char *pPrefix, const char *pMsg);
+    void Flush();
+    bool IsEnabled() const { return (m_pFile != nullptr); }
+
+    unsigned __int64 GetWrittenCount() const { return m_writtenCount; }
+    unsigned __int64 GetDroppedCount() const { return m_droppedCount; }
+
+protected:
+    static const int QUEUE_SIZE = 256;          // must be a power of two
+    static const int MAX_MESSAGE_LENGTH = 1536; // includes the timestamp, prefix, newline, and terminator; longer messages are truncated
+    static const DWORD WRITE_INTERVAL_MS = 50;  // the writer drains the queue at least this often
+
+    // a single queued message; sequence tells producers and the consumer whose turn it is to use the slot
+    struct Slot
+    {
+        atomic<size_t> sequence;
+        int length;
+        char text[MAX_MESSAGE_LENGTH];
+    };
+
+    AsyncLogWriter(FILE *pFile);   // use Open instead
+
+    void WriterThread();
+    int Drain();
+
+    FILE *m_pFile;
+    Slot *m_pSlots;                     // array of QUEUE_SIZE slots
+    atomic<size_t> m_enqueuePos;
+    size_t m_dequeuePos;                // guarded by m_drainMutex
+    mutex m_drainMutex;                 // serializes the writer thread and Flush(); producers never take it
+    HANDLE m_hWakeEvent;                // set every QUEUE_SIZE/2 messages, when the queue is full, or when we are shutting down
+    atomic<bool> m_stopRequested;
+    thread m_writerThread;
+    atomic<unsigned __int64> m_writtenCount;
+    atomic<unsigned __int64> m_droppedCount;
+    unsigned __int64 m_reportedDroppedCount;  // guarded by m_drainMutex
+    string m_registryKey;               // lowercase filename; empty if logging is disabled
+
+    // open writers, keyed by lowercase filename; guarded by s_registryMutex
+    static mutex s_registryMutex;
+    static unordered_map<string, weak_ptr<AsyncLogWriter>> s_writers;
+};
@@ -37,34 +37,31 @@
 
 #include <Shlwapi.h>   // for PathFileExists
 #include <string.h>
+#include <float.h>
 #include <atlstr.h>
 
 // Constructor
 // pDefaultFilename = path to default config file; may be relative to Orbiter root or absolute
 // pLogFilename = path to optional (but highly recommended) log file; may be null
 ConfigFileParser::ConfigFileParser(const char *pDefaultFilename, const char *pLogFilename) :
-    m_pLogFile(nullptr), m_parseFailed(false) 
+    m_parseFailed(false) 
 {
     m_csDefaultFilename = pDefaultFilename;
     
-    if (pLogFilename != nullptr)
+    // the log file is opened in APPEND mode and shared between multiple ship instances
+    m_pLogWriter = AsyncLogWriter::Open(pLogFilename);
+    if ((pLogFilename != nullptr) && !m_pLogWriter->IsEnabled())
     {
-        // open the log file in APPEND and SHARED mode so we can share it between multiple ship instances
-        m_pLogFile = fopen(pLogFilename, "a+t");
-        if (m_pLogFile == nullptr)
-        {
-            char temp[256];
-            sprintf(temp, "Error opening log file '%s' for writing; attempting to continue", pLogFilename);
-            MessageBox(nullptr, temp, "XR Framework Warning", MB_OK | MB_SETFOREGROUND);
-        }
+        char temp[256];
+        sprintf(temp, "Error opening log file '%s' for writing; attempting to continue", pLogFilename);
+        MessageBox(nullptr, temp, "XR Framework Warning", MB_OK | MB_SETFOREGROUND);
     }
 }
 
 // Destructor
 ConfigFileParser::~ConfigFileParser()
 {
-    // clean up and close our logfile
-    fclose(m_pLogFile);
+    // our log writer writes any queued messages and closes the log file when the last ship using it releases it
 }
 
 //
@@ -189,8 +186,10 @@ bool ConfigFileParser::ParseFile(const char *pFilename)
             TrimString(m_parsedName);
             TrimString(m_parsedValue);
 
-            // invoke the subclass to parse these values
-            if (ParseLine(m_section, m_parsedName, m_parsedValue, bParsingOverrideFile) == false)
+            // parse registered properties directly; otherwise, invoke the subclass to parse these values
+            const ConfigProperty *pProperty = m_propertyTable.Find(m_section, m_parsedName);
+            const bool bLineOK = ((pProperty != nullptr) ? ParseProperty(*pProperty, m_parsedValue) : ParseLine(m_section, m_parsedName, m_parsedValue, bParsingOverrideFile));
+            if (bLineOK == false)
             {
                 sprintf(temp, "Name/Value error parsing line #%d of file '%s': Line='%s'.  Check the above log message for details.", 
                     lineNumber, pFilename, m_buffer);
@@ -277,31 +276,24 @@ void ConfigFileParser::TrimString(char *pStr)
 
 
 // log a message
+// The message is timestamped and queued here; it is written to disk by our log writer's background thread, so this
+// is safe to invoke from per-frame code.
 void ConfigFileParser::WriteLog(const char *pMsg) const
 {
     // nothing to do if msg is null or if logging disabled
-    if ((pMsg == nullptr) || (m_pLogFile == nullptr)) 
+    if ((pMsg == nullptr) || !m_pLogWriter->IsEnabled()) 
         return;
 
-    CStringA csMsg;
-    // get and format the current time
-    SYSTEMTIME st;
-    GetLocalTime(&st);
-    CString csPrefix;
+    char prefix[128];
+    *prefix = 0;
     if (!GetLogPrefix().IsEmpty())
-        csPrefix.Format("[%s] ", static_cast<const char *>(GetLogPrefix()));
-
-    csMsg.Format("%02d.%02d.%04d %02d:%02d:%02d.%03d - %s%s\n", 
-        st.wMonth, st.wDay, st.wYear, 
-        st.wHour, st.wMinute, st.wSecond, st.wMilliseconds,
-        static_cast<const char *>(csPrefix), pMsg);
-
-    // no point in checking for error here
-    OutputDebugString(csMsg);   // send to debug console
-    fwrite(csMsg, 1, csMsg.GetLength(), m_pLogFile);
+    {
+        _snprintf(prefix, sizeof(prefix) - 1, "[%s] ", static_cast<const char *>(GetLogPrefix()));
+        prefix[sizeof(prefix) - 1] = 0;
+    }
 
-    // flush to disk in case we crash or are terminated
-    fflush(m_pLogFile);
+    // no point in checking for error here; dropped messages are counted and reported by the log writer
+    m_pLogWriter->Write(prefix, pMsg);
 }
 
 // logs an error and returns false if the supplied value is out-of-range
@@ -370,3 +362,229 @@ bool ConfigFileParser::ValidateFloat(const float value, const float min, const f
     return retVal;
 }
 
+
+//
+// Property registration methods; these are normally invoked from the subclass's constructor
+//
+
+void ConfigFileParser::RegisterInt(const char *pSection, const char *pName, int *pValue, const int min, const int max, const int def)
+{
+    ConfigProperty property;
+    property.section = pSection;
+    property.name = pName;
+    property.type = ConfigProperty::Type::Int;
+    property.pValue = pValue;
+    property.min = min;
+    property.max = max;
+    property.def = def;
+    property.maxLength = 0;
+    m_propertyTable.Add(property);
+}
+
+void ConfigFileParser::RegisterDouble(const char *pSection, const char *pName, double *pValue, const double min, const double max, const double def)
+{
+    ConfigProperty property;
+    property.section = pSection;
+    property.name = pName;
+    property.type = ConfigProperty::Type::Double;
+    property.pValue = pValue;
+    property.min = min;
+    property.max = max;
+    property.def = def;
+    property.maxLength = 0;
+    m_propertyTable.Add(property);
+}
+
+void ConfigFileParser::RegisterDouble(const char *pSection, const char *pName, double *pValue)
+{
+    RegisterDouble(pSection, pName, pValue, -DBL_MAX, DBL_MAX, 0);
+}
+
+void ConfigFileParser::RegisterBool(const char *pSection, const char *pName, bool *pValue)
+{
+    ConfigProperty property;
+    property.section = pSection;
+    property.name = pName;
+    property.type = ConfigProperty::Type::Bool;
+    property.pValue = pValue;
+    property.min = property.max = property.def = 0;
+    property.maxLength = 0;
+    m_propertyTable.Add(property);
+}
+
+void ConfigFileParser::RegisterString(const char *pSection, const char *pName, char *pValue, const int maxLength)
+{
+    ConfigProperty property;
+    property.section = pSection;
+    property.name = pName;
+    property.type = ConfigProperty::Type::String;
+    property.pValue = pValue;
+    property.min = property.max = property.def = 0;
+    property.maxLength = maxLength;
+    m_propertyTable.Add(property);
+}
+
+void ConfigFileParser::RegisterColor(const char *pSection, const char *pName, COLORREF *pValue)
+{
+    ConfigProperty property;
+    property.section = pSection;
+    property.name = pName;
+    property.type = ConfigProperty::Type::Color;
+    property.pValue = pValue;
+    property.min = property.max = property.def = 0;
+    property.maxLength = 0;
+    m_propertyTable.Add(property);
+}
+
+// Parse and validate the value of a registered property; this follows the same rules as the 
+// SSCANF*, STRNCPY, and VALIDATE_* macros in ConfigFileParserMacros.h.
+// Returns: true if value OK, false on error
+bool ConfigFileParser::ParseProperty(const ConfigProperty &property, const char *pValue)
+{
+    bool retVal = true;     // assume success
+
+    switch (property.type)
+    {
+    case ConfigProperty::Type::Int:
+    {
+        int * const pInt = static_cast<int *>(property.pValue);
+        if (sscanf(pValue, "%d", pInt) < 1)
+        {
+            WriteLog("Value is invalid or missing");
+            retVal = false;
+        }
+        else if (ValidateInt(*pInt, static_cast<int>(property.min), static_cast<int>(property.max)) == false)
+        {
+            *pInt = static_cast<int>(property.def);
+            retVal = false;
+        }
+        break;
+    }
+
+    case ConfigProperty::Type::Double:
+    {
+        double * const pDouble = static_cast<double *>(property.pValue);
+        if (sscanf(pValue, "%lf", pDouble) < 1)
+        {
+            WriteLog("Value is invalid or missing");
+            retVal = false;
+        }
+        else if (ValidateDouble(*pDouble, property.min, property.max) == false)
+        {
+            *pDouble = property.def;
+            retVal = false;
+        }
+        break;
+    }
+
+    case ConfigProperty::Type::Bool:
+    {
+        char c;
+        if (sscanf(pValue, "%c", &c) < 1)
+        {
+            WriteLog("Value is invalid or missing");
+            retVal = false;
+        }
+        else
+            *static_cast<bool *>(property.pValue) = ((c - '0') != 0);  // ASCII 0,1 to true/false
+        break;
+    }
+
+    case ConfigProperty::Type::String:
+    {
+        if (*pValue == 0)
+        {
+            WriteLog("Value is missing.");
+            retVal = false;
+        }
+        else
+        {
+            char * const pStr = static_cast<char *>(property.pValue);
+            strncpy(pStr, pValue, property.maxLength);
+            pStr[property.maxLength] = 0;
+        }
+        break;
+    }
+
+    case ConfigProperty::Type::Color:
+    {
+        int r, g, b;
+        if (sscanf(pValue, "%d,%d,%d", &r, &g, &b) < 3)
+        {
+            WriteLog("One or more values are invalid or missing; 3 values required");
+            retVal = false;
+        }
+        else
+            *static_cast<COLORREF *>(property.pValue) = RGB(r, g, b);
+        break;
+    }
+
+    default:
+        retVal = false;     // should never happen
+        break;
+    }
+
+    return retVal;
+}
+
+// Write the current value of every registered property to the specified file in config file format, grouped by section.
+// Properties that are parsed by the subclass's ParseLine method are not included.
+// Returns: true on success, false on I/O error
+bool ConfigFileParser::WriteResolvedConfig(const char *pFilename) const
+{
+    static char temp[MAX_LINE_LENGTH + 128];  // reused for messages and output lines
+
+    FILE *pFile = fopen(pFilename, "wt");
+    if (pFile == nullptr)
+    {
+        sprintf(temp, "ERROR: fopen failed for '%s'; GetLastError=0x%X", pFilename, GetLastError());
+        WriteLog(temp);
+        return false;
+    }
+
+    fprintf(pFile, "# Resolved configuration from %s\n", static_cast<const char *>(m_csConfigFilenames.IsEmpty() ? m_csDefaultFilename : m_csConfigFilenames));
+
+    const string *pLastSection = nullptr;
+    for (const ConfigProperty &property : m_propertyTable.GetProperties())
+    {
+        // properties are sorted by case-folded key, so each section's properties are contiguous
+        if ((pLastSection == nullptr) || (_stricmp(pLastSection->c_str(), property.section.c_str()) != 0))
+        {
+            fprintf(pFile, "\n[%s]\n", property.section.c_str());
+            pLastSection = &property.section;
+        }
+
+        switch (property.type)
+        {
+        case ConfigProperty::Type::Int:
+            fprintf(pFile, "%s=%d\n", property.name.c_str(), *static_cast<const int *>(property.pValue));
+            break;
+
+        case ConfigProperty::Type::Double:
+            fprintf(pFile, "%s=%.10g\n", property.name.c_str(), *static_cast<const double *>(property.pValue));
+            break;
+
+        case ConfigProperty::Type::Bool:
+            fprintf(pFile, "%s=%d\n", property.name.c_str(), (*static_cast<const bool *>(property.pValue) ? 1 : 0));
+            break;
+
+        case ConfigProperty::Type::String:
+            fprintf(pFile, "%s=%s\n", property.name.c_str(), static_cast<const char *>(property.pValue));
+            break;
+
+        case ConfigProperty::Type::Color:
+        {
+            const COLORREF color = *static_cast<const COLORREF *>(property.pValue);
+            fprintf(pFile, "%s=%d,%d,%d\n", property.name.c_str(), GetRValue(color), GetGValue(color), GetBValue(color));
+            break;
+        }
+        }
+    }
+
+    const bool retVal = (ferror(pFile) == 0);
+    fclose(pFile);
+
+    sprintf(temp, "%s resolved configuration (%d properties) to '%s'", (retVal ? "Wrote" : "ERROR writing"), static_cast<int>(m_propertyTable.GetProperties().size()), pFilename);
+    WriteLog(temp);
+    return retVal;
+}
@@ -34,6 +34,9 @@
 #include <atlstr.h>		// for CString
 #include <fstream>      // for ifstream
 
+#include "ConfigPropertyTable.h"
+#include "AsyncLogWriter.h"
+
 const int MAX_LINE_LENGTH = 1024;
 const int MAX_NAME_LENGTH = 256;
 const int MAX_VALUE_LENGTH = (MAX_LINE_LENGTH - MAX_NAME_LENGTH - 1);
@@ -66,6 +69,9 @@ public:
     void SetLogPrefix(const char *pPrefix) { m_logPrefix = pPrefix; }
 
     void WriteLog(const char *pMsg) const;
+    void FlushLog() const { m_pLogWriter->Flush(); }   // synchronously write all queued log messages; invoke this before terminating the process
+    unsigned __int64 GetDroppedLogMessageCount() const { return m_pLogWriter->GetDroppedCount(); }  // messages dropped because the log queue was full
+    bool WriteResolvedConfig(const char *pFilename) const;
 
     //
     // Static utility methods
@@ -89,11 +95,21 @@ protected:
     bool ValidateDouble(const double value, const double min, const double max) const;
     bool ValidateFloat(const float value, const float min, const float max) const;
 
-    // the subclass must implement this method
+    // Properties registered here are parsed and validated by ParseFile without invoking ParseLine.
+    // Registering the same section and name again replaces the earlier registration, so a subclass may override its base class.
+    void RegisterInt(const char *pSection, const char *pName, int *pValue, const int min, const int max, const int def);
+    void RegisterDouble(const char *pSection, const char *pName, double *pValue, const double min, const double max, const double def);
+    void RegisterDouble(const char *pSection, const char *pName, double *pValue);   // any value is valid
+    void RegisterBool(const char *pSection, const char *pName, bool *pValue);
+    void RegisterString(const char *pSection, const char *pName, char *pValue, const int maxLength);  // maxLength does NOT include the terminator
+    void RegisterColor(const char *pSection, const char *pName, COLORREF *pValue);   // parsed from "r,g,b"
+    bool ParseProperty(const ConfigProperty &property, const char *pValue);
+
+    // the subclass must implement this method; it is invoked for each line that does not match a registered property
     virtual bool ParseLine(const char *pSection, const char *pName, const char *pValue, const bool bParsingOverrideFile) = 0;
 
     bool m_parseFailed;     // true if parse failed, false if it succeeded
-    FILE *m_pLogFile;
+    shared_ptr<AsyncLogWriter> m_pLogWriter;  // shared by all parsers logging to the same file; never null
     CString m_csDefaultFilename;          // e.g,. "Config\XR2RavenstarPrefs.cfg"
     char m_buffer[MAX_LINE_LENGTH];
     char m_section[256];                  // value between brackets in [SECTION]; changes as each new section is encountered
@@ -102,6 +118,7 @@ protected:
 
     CString m_csOverrideFilename;   // e.g,. "Config\XR2-foobar1.xrcfg"; may be empty
     CString m_csConfigFilenames;    // cosmetic string: "Config\XR2RavenstarPrefs.cfg + Config\XR2-foobar.xrcfg"
+    ConfigPropertyTable m_propertyTable;
 
 private:
     CString m_logPrefix;
@@ -0,0 +1,85 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+// ==============================================================
+// ConfigPropertyTable.cpp
+// Sorted lookup table of config file properties that can be parsed
+// without custom code.
+// ==============================================================
+
+#include "ConfigPropertyTable.h"
+#include "ConfigFileParser.h"
+
+#include <algorithm>
+#include <ctype.h>
+#include <string.h>
+
+// Add a property to the table; if a property with the same section and name already exists it is replaced.
+// This allows a subclass's parser to override a property registered by its base class.
+void ConfigPropertyTable::Add(const ConfigProperty &property)
+{
+    ConfigProperty newProperty = property;
+    newProperty.key = MakeKey(property.section.c_str(), property.name.c_str());
+
+    // keep the vector sorted so that Find can do a binary search
+    auto it = lower_bound(m_properties.begin(), m_properties.end(), newProperty.key,
+        [](const ConfigProperty &p, const string &key) { return p.key < key; });
+    if ((it != m_properties.end()) && (it->key == newProperty.key))
+        *it = newProperty;      // replace existing property
+    else
+        m_properties.insert(it, newProperty);
+}
+
+// Returns the property for the supplied section and name, or nullptr if no such property is registered.
+// The comparison is case-insensitive, the same as SECTION_MATCHES and PNAME_MATCHES.
+const ConfigProperty *ConfigPropertyTable::Find(const char *pSection, const char *pName) const
+{
+    // build the case-folded key on the stack; this is invoked for every line in the config file
+    char key[256 + MAX_NAME_LENGTH + 2];
+    char *pOut = key;
+    const char * const pEnd = key + sizeof(key) - 1;
+    for (const char *p = pSection; *p && (pOut < pEnd); p++)
+        *pOut++ = static_cast<char>(tolower(static_cast<unsigned char>(*p)));
+    if (pOut < pEnd)
+        *pOut++ = '\n';
+    for (const char *p = pName; *p && (pOut < pEnd); p++)
+        *pOut++ = static_cast<char>(tolower(static_cast<unsigned char>(*p)));
+    *pOut = 0;
+
+    auto it = lower_bound(m_properties.begin(), m_properties.end(), key,
+        [](const ConfigProperty &p, const char *pKey) { return strcmp(p.key.c_str(), pKey) < 0; });
+    if ((it != m_properties.end()) && (strcmp(it->key.c_str(), key) == 0))
+        return &(*it);
+
+    return nullptr;
+}
+
+// Returns the case-folded lookup key for the supplied section and name
+string ConfigPropertyTable::MakeKey(const char *pSection, const char *pName)
+{
+    string retVal = pSection;
+    retVal += '\n';
+    retVal += pName;
+    for (char &c : retVal)
+        c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+
+    return retVal;
+}
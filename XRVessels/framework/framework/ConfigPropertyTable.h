@@ -0,0 +1,66 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+// ==============================================================
+// ConfigPropertyTable.h
+// Sorted lookup table of config file properties that can be parsed
+// without custom code: each property maps a (section, name) pair to a
+// typed variable along with its valid range and default value.
+// ==============================================================
+
+#pragma once
+
+#include <Windows.h>
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// a single registered property
+struct ConfigProperty
+{
+    enum class Type { Int, Double, Bool, String, Color };
+
+    string key;         // case-folded "section\nname"; used for lookups
+    string section;     // as registered; e.g., "GENERAL"
+    string name;        // as registered; e.g., "MainFuelISP"
+    Type type;
+    void *pValue;       // int *, double *, bool *, char *, or COLORREF * depending on type
+    double min;         // Int and Double only
+    double max;         // Int and Double only
+    double def;         // Int and Double only; value is reset to this if out-of-range
+    int maxLength;      // String only; does NOT include space for the terminator
+};
+
+class ConfigPropertyTable
+{
+public:
+    void Add(const ConfigProperty &property);
+    const ConfigProperty *Find(const char *pSection, const char *pName) const;
+
+    const vector<ConfigProperty> &GetProperties() const { return m_properties; }  // sorted by key
+
+    static string MakeKey(const char *pSection, const char *pName);
+
+protected:
+    vector<ConfigProperty> m_properties;    // sorted by key
+};
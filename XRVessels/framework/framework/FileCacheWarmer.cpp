@@ -0,0 +1,127 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+
+// ==============================================================
+// FileCacheWarmer.cpp
+// Reads files once on a background thread to warm the OS file cache.
+// ==============================================================
+
+#include "FileCacheWarmer.h"
+#include "FileList.h"
+
+#include <ctype.h>
+
+mutex FileCacheWarmer::s_mutex;
+set<string> FileCacheWarmer::s_warmedPaths;
+deque<FileCacheWarmer::Request> FileCacheWarmer::s_requests;
+thread FileCacheWarmer::s_workerThread;
+bool FileCacheWarmer::s_isWorkerRunning = false;
+atomic<bool> FileCacheWarmer::s_stopRequested(false);
+
+// Queue a directory to be warmed; this returns immediately.  Subfolders are not included.
+// pPath = directory to warm, e.g., "XRSound\Default"; may be relative to Orbiter root or absolute
+// pFileTypeToAccept = case-insensitive file extension to warm, e.g., ".wav"
+void FileCacheWarmer::WarmDirectory(const char *pPath, const char *pFileTypeToAccept)
+{
+    string key(pPath);
+    for (char &c : key)
+        c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+
+    lock_guard<mutex> lock(s_mutex);
+    if (s_stopRequested || !s_warmedPaths.insert(key).second)
+        return;     // shutting down, or another vessel already warmed this directory
+
+    Request request;
+    request.path = pPath;
+    request.fileTypeToAccept = pFileTypeToAccept;
+    s_requests.push_back(request);
+
+    // the worker exits when the queue is empty, so start a new one if necessary
+    if (!s_isWorkerRunning)
+    {
+        if (s_workerThread.joinable())
+            s_workerThread.join();  // previous worker has already exited, so this does not block
+
+        s_isWorkerRunning = true;
+        s_workerThread = thread(&FileCacheWarmer::WorkerThread);
+    }
+}
+
+// Stops the worker thread, abandoning any files not warmed yet.  This must be invoked before our module is unloaded.
+void FileCacheWarmer::Terminate()
+{
+    s_stopRequested = true;
+    if (s_workerThread.joinable())
+        s_workerThread.join();
+
+    lock_guard<mutex> lock(s_mutex);
+    s_requests.clear();
+    s_isWorkerRunning = false;
+}
+
+// Background thread: warm each queued directory, then exit
+void FileCacheWarmer::WorkerThread()
+{
+    // the sim thread comes first
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+
+    for (;;)
+    {
+        Request request;
+        {
+            lock_guard<mutex> lock(s_mutex);
+            if (s_requests.empty() || s_stopRequested)
+            {
+                s_isWorkerRunning = false;
+                return;
+            }
+            request = s_requests.front();
+            s_requests.pop_front();
+        }
+
+        FileList fileList(request.path.c_str(), false, request.fileTypeToAccept.c_str());
+        fileList.Scan();
+        for (const CString &filespec : fileList.GetScannedFilesList())
+        {
+            if (s_stopRequested)
+                break;
+            WarmFile(filespec);
+        }
+    }
+}
+
+// Read a file and discard the data; any error is ignored, since the real load will report it
+void FileCacheWarmer::WarmFile(const char *pFilespec)
+{
+    const HANDLE hFile = CreateFile(pFilespec, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)
+        return;
+
+    static char s_buffer[64 * 1024];    // only used by the worker thread
+    DWORD bytesRead;
+    while (!s_stopRequested && ReadFile(hFile, s_buffer, sizeof(s_buffer), &bytesRead, nullptr) && (bytesRead > 0))
+    {
+        // nothing to do: the OS caches the file as we read it
+    }
+
+    CloseHandle(hFile);
+}
@@ -0,0 +1,67 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+
+// ==============================================================
+// FileCacheWarmer.h
+// Reads files once on a background thread so that the OS file cache
+// already holds them the first time they are really loaded.  Nothing
+// read here is retained: this is for APIs such as XRSound's LoadWav that
+// only accept a filename.  One worker thread is shared by all vessels in
+// this module, and each directory is warmed at most once per session.
+// ==============================================================
+
+#pragma once
+
+#include <Windows.h>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+class FileCacheWarmer
+{
+public:
+    static void WarmDirectory(const char *pPath, const char *pFileTypeToAccept);
+    static void Terminate();  // clients must invoke this from their ExitModule method
+
+protected:
+    struct Request
+    {
+        string path;
+        string fileTypeToAccept;  // e.g., ".wav"
+    };
+
+    static void WorkerThread();
+    static void WarmFile(const char *pFilespec);
+
+    static mutex s_mutex;                       // guards all static data below except s_stopRequested
+    static set<string> s_warmedPaths;           // lowercase paths already queued this session
+    static deque<Request> s_requests;
+    static thread s_workerThread;
+    static bool s_isWorkerRunning;
+    static atomic<bool> s_stopRequested;
+};
@@ -39,6 +39,9 @@ public:
 
     // subclass must implement this method
     virtual void clbkPrePostStep(const double simt, const double simdt, const double mjd) = 0;
+
+    // Optionally write step-specific statistics to pBuffer for the PreStep/PostStep profiler report; returns true if pBuffer was populated.
+    virtual bool GetProfilerDetails(char *pBuffer, const int bufferLength) const { return false; }
     
 private:
     VESSEL3_EXT &m_vessel;
@@ -0,0 +1,139 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+// ==============================================================
+// PrePostStepProfiler.cpp
+// Collects per-step timing statistics for the PreStep and PostStep
+// objects invoked from VESSEL3_EXT::clbkPreStep/clbkPostStep.
+// ==============================================================
+
+#include "PrePostStepProfiler.h"
+#include "PrePostStep.h"
+#include "ConfigFileParser.h"
+
+#include <algorithm>
+#include <typeinfo>
+
+// Constructor
+// pLabel = "PreStep" or "PostStep"; must be a static string
+PrePostStepProfiler::PrePostStepProfiler(const char *pLabel) :
+    m_pLabel(pLabel), m_microsPerTick(0)
+{
+    LARGE_INTEGER freq;
+    if (QueryPerformanceFrequency(&freq) && (freq.QuadPart > 0))
+        m_microsPerTick = 1.0e6 / static_cast<double>(freq.QuadPart);
+}
+
+// Record a single timing sample for the step at stepIndex in the vessel's step vector
+void PrePostStepProfiler::AddSample(const int stepIndex, const PrePostStep *pStep, const LONGLONG elapsedTicks)
+{
+    if (stepIndex >= static_cast<int>(m_stepStats.size()))
+        m_stepStats.resize(stepIndex + 1);
+
+    StepStats &stats = m_stepStats[stepIndex];
+    if (stats.sampleCount == 0)
+    {
+        // first sample for this step
+        stats.name = GetStepName(pStep);
+        stats.pStep = pStep;
+        stats.ring.reserve(SAMPLE_RING_SIZE);
+    }
+
+    const double micros = static_cast<double>(elapsedTicks) * m_microsPerTick;
+    if ((stats.sampleCount == 0) || (micros < stats.minMicros))
+        stats.minMicros = micros;
+    if (micros > stats.maxMicros)
+        stats.maxMicros = micros;
+    stats.totalMicros += micros;
+    stats.sampleCount++;
+
+    if (static_cast<int>(stats.ring.size()) < SAMPLE_RING_SIZE)
+    {
+        stats.ring.push_back(static_cast<float>(micros));
+    }
+    else
+    {
+        stats.ring[stats.ringIndex] = static_cast<float>(micros);
+        if (++stats.ringIndex >= SAMPLE_RING_SIZE)
+            stats.ringIndex = 0;
+    }
+}
+
+// Returns the requested percentile (0 < fraction <= 1) of the most recent samples, in microseconds
+double PrePostStepProfiler::StepStats::GetPercentileMicros(const double fraction) const
+{
+    if (ring.empty())
+        return 0;
+
+    vector<float> sorted(ring);   // work on a copy so the ring order is preserved
+    size_t index = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+    if (index >= sorted.size())
+        index = sorted.size() - 1;
+    nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return sorted[index];
+}
+
+// Returns the class name of the supplied step object, minus any "class " prefix
+string PrePostStepProfiler::GetStepName(const PrePostStep *pStep)
+{
+    string retVal = typeid(*pStep).name();
+    const char *pPrefix = "class ";
+    if (retVal.compare(0, strlen(pPrefix), pPrefix) == 0)
+        retVal.erase(0, strlen(pPrefix));
+
+    return retVal;
+}
+
+// Write a timing table to the log, most expensive step (by mean) first
+void PrePostStepProfiler::WriteReport(const ConfigFileParser &log) const
+{
+    if (m_stepStats.empty())
+        return;     // nothing recorded
+
+    static char msg[512];
+    static char details[256];
+    double totalMeanMicros = 0;
+    vector<const StepStats *> sortedStats;
+    for (const StepStats &stats : m_stepStats)
+    {
+        if (stats.sampleCount == 0)
+            continue;
+        sortedStats.push_back(&stats);
+        totalMeanMicros += stats.GetMeanMicros();
+    }
+    sort(sortedStats.begin(), sortedStats.end(), [](const StepStats *a, const StepStats *b) { return a->GetMeanMicros() > b->GetMeanMicros(); });
+
+    sprintf(msg, "%s profile: %d step objects, total mean %.2lf us/frame (min/mean/p99/max in microseconds)", m_pLabel, static_cast<int>(sortedStats.size()), totalMeanMicros);
+    log.WriteLog(msg);
+
+    for (const StepStats *pStats : sortedStats)
+    {
+        sprintf(msg, "  %-40.40s  frames=%-8I64u  min=%8.2lf  mean=%8.2lf  p99=%8.2lf  max=%9.2lf", pStats->name.c_str(), pStats->sampleCount,
+            pStats->minMicros, pStats->GetMeanMicros(), pStats->GetPercentileMicros(0.99), pStats->maxMicros);
+        log.WriteLog(msg);
+
+        if (pStats->pStep->GetProfilerDetails(details, sizeof(details)))
+        {
+            sprintf(msg, "      %s", details);
+            log.WriteLog(msg);
+        }
+    }
+}
@@ -0,0 +1,90 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+// ==============================================================
+// PrePostStepProfiler.h
+// Collects per-step timing statistics for the PreStep and PostStep
+// objects invoked from VESSEL3_EXT::clbkPreStep/clbkPostStep.
+// ==============================================================
+
+#pragma once
+
+#include "windows.h"
+
+#include <vector>
+#include <string>
+
+// Uncomment this (or define it in the project's preprocessor settings) to time each PrePostStep object every frame
+// and write a report to the vessel's log file when the vessel is destroyed.  This is off by default: when it is not
+// defined, the clbkPreStep/clbkPostStep dispatch loops are unchanged and there is no per-frame overhead at all.
+// #define XR_PREPOSTSTEP_PROFILER
+
+class PrePostStep;
+class ConfigFileParser;
+
+using namespace std;
+
+class PrePostStepProfiler
+{
+public:
+    PrePostStepProfiler(const char *pLabel);
+
+    // Returns the current high-resolution timer value in ticks
+    static LONGLONG GetTicks()
+    {
+        LARGE_INTEGER ticks;
+        QueryPerformanceCounter(&ticks);
+        return ticks.QuadPart;
+    }
+
+    void AddSample(const int stepIndex, const PrePostStep *pStep, const LONGLONG elapsedTicks);
+    void WriteReport(const ConfigFileParser &log) const;
+    void Reset() { m_stepStats.clear(); }
+    bool IsEmpty() const { return m_stepStats.empty(); }
+
+protected:
+    // number of most recent samples retained per step for percentile calculation
+    static const int SAMPLE_RING_SIZE = 1024;
+
+    // timing data for a single PrePostStep object
+    struct StepStats
+    {
+        StepStats() : pStep(nullptr), minMicros(0), maxMicros(0), totalMicros(0), sampleCount(0), ringIndex(0) { }
+
+        double GetMeanMicros() const { return ((sampleCount > 0) ? (totalMicros / sampleCount) : 0); }
+        double GetPercentileMicros(const double fraction) const;
+
+        string name;              // class name of the step object
+        const PrePostStep *pStep; // step object itself; steps live until the vessel is destroyed
+        double minMicros;
+        double maxMicros;
+        double totalMicros;
+        unsigned __int64 sampleCount;
+        vector<float> ring;       // most recent samples in microseconds; grows to SAMPLE_RING_SIZE and then wraps
+        int ringIndex;            // next slot to overwrite once ring is full
+    };
+
+    static string GetStepName(const PrePostStep *pStep);
+
+    const char *m_pLabel;         // "PreStep" or "PostStep"
+    double m_microsPerTick;       // from QueryPerformanceFrequency
+    vector<StepStats> m_stepStats; // index = step's index in the vessel's PreStep or PostStep vector
+};
@@ -0,0 +1,104 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+
+// ==============================================================
+// RedrawScheduler.cpp
+// Throttles PANEL_REDRAW_ALWAYS events using a dense table of
+// per-area redraw deadlines indexed by area ID.
+// ==============================================================
+
+#include "RedrawScheduler.h"
+
+#include <math.h>
+
+// Constructor
+RedrawScheduler::RedrawScheduler() :
+    m_frameTime(0), m_scheduledAreaCount(0)
+{
+}
+
+// Returns the slot for the supplied area ID, growing the table if necessary.
+// Area IDs are small, mostly contiguous integers, so the table stays compact.
+RedrawScheduler::AreaSlot &RedrawScheduler::GetSlot(const int areaID)
+{
+    const int index = ((areaID >= 0) ? areaID : 0);   // defensive: area IDs are never negative
+    if (index >= static_cast<int>(m_slots.size()))
+        m_slots.resize(index + 1);
+
+    return m_slots[index];
+}
+
+// Returns true if a redraw interval was set for the supplied area via SetRedrawInterval
+bool RedrawScheduler::HasRedrawInterval(const int areaID) const
+{
+    return ((areaID >= 0) && (areaID < static_cast<int>(m_slots.size())) && m_slots[areaID].hasInterval);
+}
+
+// Set the default redraw interval for the supplied area
+// interval = seconds between redraws; <= 0 = redraw every frame
+void RedrawScheduler::SetRedrawInterval(const int areaID, const double interval)
+{
+    AreaSlot &slot = GetSlot(areaID);
+    slot.interval = interval;
+    slot.hasInterval = true;
+}
+
+// Returns true if the supplied area is due to be redrawn this frame using the interval set via SetRedrawInterval.
+// If true is returned, the area's next redraw is scheduled.
+bool RedrawScheduler::IsRedrawDue(const int areaID)
+{
+    return IsRedrawDue(areaID, GetSlot(areaID).interval);
+}
+
+// Returns true if the supplied area is due to be redrawn this frame using the supplied interval.
+// If true is returned, the area's next redraw is scheduled.
+// interval = seconds between redraws; <= 0 = redraw every frame
+bool RedrawScheduler::IsRedrawDue(const int areaID, const double interval)
+{
+    if (interval <= 0)
+        return true;    // no throttling for this area
+
+    AreaSlot &slot = GetSlot(areaID);
+    if (!slot.isScheduled)
+    {
+        // First redraw for this area: draw it now, and spread its subsequent redraws across the interval using the
+        // golden ratio so that areas sharing the same interval do not all redraw on the same frame.
+        const double goldenRatioFraction = 0.6180339887498949;
+        double unused;
+        slot.phase = 1.0 - modf(m_scheduledAreaCount * goldenRatioFraction, &unused);  // 0 < phase <= 1
+        slot.nextRedraw = m_frameTime + (interval * slot.phase);
+        slot.isScheduled = true;
+        m_scheduledAreaCount++;
+        return true;
+    }
+
+    if (m_frameTime < slot.nextRedraw)
+        return false;   // not time to redraw this area yet
+
+    // Advance by whole intervals so the area keeps its phase; if we fell more than an interval behind (e.g., the
+    // panel was not visible or the frame rate dropped), restart the schedule from this frame instead of catching up.
+    slot.nextRedraw += interval;
+    if (slot.nextRedraw <= m_frameTime)
+        slot.nextRedraw = m_frameTime + (interval * slot.phase);
+
+    return true;
+}
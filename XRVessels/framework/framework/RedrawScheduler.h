@@ -0,0 +1,68 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+
+// ==============================================================
+// RedrawScheduler.h
+// Throttles PANEL_REDRAW_ALWAYS events using a dense table of
+// per-area redraw deadlines indexed by area ID.
+// ==============================================================
+
+#pragma once
+
+#include <vector>
+
+using namespace std;
+
+class RedrawScheduler
+{
+public:
+    RedrawScheduler();
+
+    // Set the realtime clock value, in seconds, to use for all redraw checks this frame; this should come from a
+    // monotonic clock that is sampled once per frame, such as oapiGetSysTime().
+    void SetFrameTime(const double frameTime) { m_frameTime = frameTime; }
+    double GetFrameTime() const { return m_frameTime; }
+
+    bool HasRedrawInterval(const int areaID) const;
+    void SetRedrawInterval(const int areaID, const double interval);
+    bool IsRedrawDue(const int areaID);
+    bool IsRedrawDue(const int areaID, const double interval);
+
+protected:
+    // redraw state for a single area
+    struct AreaSlot
+    {
+        AreaSlot() : nextRedraw(0), interval(0), phase(0), isScheduled(false), hasInterval(false) { }
+
+        double nextRedraw;      // frame time at or after which this area is due to be redrawn
+        double interval;        // seconds between redraws; <= 0 = redraw every frame
+        double phase;           // fraction of an interval (0 < phase <= 1) by which this area's redraws are offset from the other areas
+        bool isScheduled;       // false = area has not been redrawn yet
+        bool hasInterval;       // true if interval was set via SetRedrawInterval
+    };
+
+    AreaSlot &GetSlot(const int areaID);
+
+    vector<AreaSlot> m_slots;   // index = area ID
+    double m_frameTime;         // set by SetFrameTime
+    int m_scheduledAreaCount;   // number of areas scheduled so far; used to stagger each new area's redraws
+};
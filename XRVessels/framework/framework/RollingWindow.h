@@ -0,0 +1,207 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+
+// ==============================================================
+// RollingWindow.h
+// Template class that manages a fixed-size rolling window of samples
+// and keeps their running sum and sort order up to date as each
+// sample is added.
+// ==============================================================
+
+#pragma once
+
+#include <crtdbg.h>   // for _ASSERTE
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// Once the window is full, each new sample replaces the oldest one.
+// The sum is maintained with Kahan (compensated) summation and is recomputed from the samples each time the window wraps
+// around, so it cannot drift no matter how long the window runs.  The sum and mean are O(1).
+// A sorted copy of the samples is maintained as well, so the median and other percentiles are O(1) to read; each new sample 
+// costs a binary search plus a short move in the sorted copy.
+template<class T>
+class RollingWindow
+{
+public:
+    // Constructor
+    // capacity = maximum # of samples in the window; must be > 0
+    RollingWindow(const int capacity) :
+        m_capacity(capacity), m_sampleIndex(0), m_sampleCount(0), m_sum(0), m_sumCompensation(0)
+    {
+        _ASSERTE(capacity > 0);
+        m_samples.resize(capacity);
+        m_sortedSamples.reserve(capacity);
+    }
+
+    // Destructor
+    virtual ~RollingWindow() { }
+
+    // Add a new sample, replacing the oldest sample if the window is full
+    void AddSample(const T value)
+    {
+        if (m_sampleCount == m_capacity)
+        {
+            // window is full, so the oldest sample drops out
+            const T oldest = m_samples[m_sampleIndex];
+            AddToSum(-oldest);
+            RemoveSortedSample(oldest);
+        }
+        else
+        {
+            m_sampleCount++;        // still filling the window
+        }
+
+        m_samples[m_sampleIndex] = value;
+        AddToSum(value);
+        m_sortedSamples.insert(upper_bound(m_sortedSamples.begin(), m_sortedSamples.end(), value), value);
+
+        if (++m_sampleIndex >= m_capacity)
+        {
+            m_sampleIndex = 0;      // wrap around
+            RecomputeSum();         // discard any rounding error accumulated since the last wrap
+        }
+    }
+
+    // Returns the maximum # of samples in the window
+    int GetCapacity() const { return m_capacity; }
+
+    // Returns the number of samples in the window
+    // (Will start at zero and grow to the capacity, where it will stay from then on.)
+    int GetSampleCount() const { return m_sampleCount; }
+
+    // Returns the sum of all samples in the window
+    T GetSum() const { return m_sum; }
+
+    // Returns the mean of all samples in the window, or 0 if the window is empty
+    T GetMean() const
+    {
+        if (m_sampleCount == 0)
+        {
+            _ASSERTE(false);  // program bug!  no samples in window yet
+            return 0;   // try to continue
+        }
+
+        return m_sum / static_cast<T>(m_sampleCount);
+    }
+
+    // Returns the median sample in the window (the upper median if there is an even number of samples), or 0 if the window is empty
+    T GetMedian() const
+    {
+        if (m_sampleCount == 0)
+        {
+            _ASSERTE(false);  // program bug!  no samples in window yet
+            return 0;   // try to continue
+        }
+
+        return m_sortedSamples[m_sampleCount / 2];
+    }
+
+    // Returns the sample at the requested percentile (0 <= fraction <= 1), or 0 if the window is empty
+    T GetPercentile(const double fraction) const
+    {
+        if (m_sampleCount == 0)
+        {
+            _ASSERTE(false);  // program bug!  no samples in window yet
+            return 0;   // try to continue
+        }
+
+        int index = static_cast<int>((fraction * (m_sampleCount - 1)) + 0.5);
+        if (index < 0)
+            index = 0;
+        else if (index >= m_sampleCount)
+            index = m_sampleCount - 1;
+
+        return m_sortedSamples[index];
+    }
+
+    // Returns the newest sample in the window
+    T GetNewest() const
+    {
+        if (m_sampleCount == 0)
+        {
+            _ASSERTE(false);  // program bug!  no samples in window yet
+            return 0;   // try to continue
+        }
+
+        // the newest sample is just before m_sampleIndex; if m_sampleIndex is 0 we wrapped around
+        return m_samples[((m_sampleIndex == 0) ? (m_capacity - 1) : (m_sampleIndex - 1))];
+    }
+
+    // Returns the oldest sample in the window
+    T GetOldest() const
+    {
+        if (m_sampleCount == 0)
+        {
+            _ASSERTE(false);  // program bug!  no samples in window yet
+            return 0;   // try to continue
+        }
+
+        // Once the window is full the oldest sample is sitting at m_sampleIndex, which always points to the entry that will be overwritten next.
+        // Until then, the oldest sample is the first one added.
+        return m_samples[((m_sampleCount == m_capacity) ? m_sampleIndex : 0)];
+    }
+
+    // Resets the window to empty
+    void Clear()
+    {
+        m_sampleIndex = m_sampleCount = 0;
+        m_sum = m_sumCompensation = 0;
+        m_sortedSamples.clear();
+    }
+
+protected:
+    // Kahan summation: m_sumCompensation carries the low-order bits lost by the previous addition
+    void AddToSum(const T value)
+    {
+        const T y = value - m_sumCompensation;
+        const T t = m_sum + y;
+        m_sumCompensation = (t - m_sum) - y;
+        m_sum = t;
+    }
+
+    // Recompute the sum from the samples in the window
+    void RecomputeSum()
+    {
+        m_sum = m_sumCompensation = 0;
+        for (int i = 0; i < m_sampleCount; i++)
+            AddToSum(m_samples[i]);
+    }
+
+    // Remove a single copy of value from the sorted samples
+    void RemoveSortedSample(const T value)
+    {
+        auto it = lower_bound(m_sortedSamples.begin(), m_sortedSamples.end(), value);
+        if (it == m_sortedSamples.end())
+            --it;   // only possible if the window contains values that do not compare (e.g., NaN); keep the sample counts in step regardless
+        m_sortedSamples.erase(it);
+    }
+
+    const int m_capacity;       // maximum # of samples in the window
+    int m_sampleIndex;          // index of the NEXT entry in m_samples to be written (i.e., entry that will be overwritten next)
+    int m_sampleCount;          // # of samples in the window so far; grows on startup from 0 -> m_capacity, then stays there
+    T m_sum;                    // running sum of all samples in the window
+    T m_sumCompensation;        // Kahan compensation term for m_sum
+    vector<T> m_samples;        // ring buffer of samples in the order added; size = m_capacity
+    vector<T> m_sortedSamples;  // same samples as m_samples, sorted ascending; size = m_sampleCount
+};
@@ -39,7 +39,8 @@ VESSEL3_EXT::VESSEL3_EXT(OBJHANDLE vessel, int fmodel) :
     XRVesselCtrl(vessel, fmodel),
     m_hModule(nullptr), m_hasFocus(false), exmesh_tpl(nullptr),
 	m_videoWindowWidth(0), m_videoWindowHeight(0), m_lastVideoWindowWidth(-1), m_last2DPanelWidth(0),
-    m_absoluteSimTime(0), m_pConfig(nullptr)
+    m_absoluteSimTime(0), m_pConfig(nullptr), m_pActivePanel(nullptr),
+    m_preStepProfiler("PreStep"), m_postStepProfiler("PostStep")
 {
 	m_regKeyManager.Initialize(HKEY_CURRENT_USER, XR_GLOBAL_SETTINGS_REG_KEY, nullptr);   // should always succeed
 }
@@ -65,15 +66,14 @@ VESSEL3_EXT::~VESSEL3_EXT()
     }
 
     // clean up our grapple target vessel cache; this will be empty for vessels that never invoke GetGrappleTargetVessel(...)
+    // Note: each key references the name inside its XRGrappleTargetVessel, so only the values need to be freed
     auto it3 = m_grappleTargetMap.begin();   // iterates over values
     for (; it3 != m_grappleTargetMap.end(); it3++)
     {
-        const string *pName = it3->first;
         XRGrappleTargetVessel *pGrappleTarget = it3->second;
-
-        delete pName;
         delete pGrappleTarget;
     }
+    m_grappleTargetMap.clear();     // keys are now dangling
 }
 
 // Add a new instrument panel to our map of panels
@@ -133,21 +133,11 @@ InstrumentPanel *VESSEL3_EXT::GetInstrumentPanel(const int panelNumber)
 // Trigger a redraw are for the supplied area ID by sending the request to each of our panels
 bool VESSEL3_EXT::TriggerRedrawArea(const int areaID)
 {
-    // iterate through each of our instrument panels and send the request to each
-    bool wasProcessed = false;
-
-    InstrumentPanelIterator it = m_panelMap.begin();   // iterates over values
-
     // for efficiency, only send this redraw request to the active panel
-    for (; it != m_panelMap.end(); it++)
-    {
-        InstrumentPanel *pPanel = it->second;  // get next panel in the map
-        if (pPanel->IsActive())
-        {
-            wasProcessed = pPanel->TriggerRedrawArea(areaID);
-            break;    // only one active panel at a time, so no need to check the others
-        }
-    }
+    bool wasProcessed = false;
+    InstrumentPanel *pPanel = GetActivePanel();
+    if (pPanel != nullptr)
+        wasProcessed = pPanel->TriggerRedrawArea(areaID);
 
     return wasProcessed;
 }
@@ -177,7 +167,10 @@ bool VESSEL3_EXT::clbkLoadPanel(int panelID)
     InstrumentPanel *pPanel = GetInstrumentPanel(panelID);   // retrieves cached panel of the correct resolution active video mode
     bool activationSuccessful = pPanel->Activate();   // if null here, the caller screwed up and we will (correctly) crash
     if (activationSuccessful)
+    {
         pPanel->SetActive(true);    // mark as active so the panel's Activate() method doesn't have to remember to do it
+        m_pActivePanel = pPanel;    // cache it so event dispatch does not have to search the panel map
+    }
 
     return activationSuccessful;
 }
@@ -191,9 +184,21 @@ void VESSEL3_EXT::DeactivateAllPanels()
         InstrumentPanel *pPanel = it->second;  // get next panel in the map
         pPanel->Deactivate();   // release all surfaces
     }
+    m_pActivePanel = nullptr;   // no active panel now
 }
 
 
+// Returns the currently active panel, or nullptr if no panel is active.
+// This is cached by clbkLoadPanel so that per-frame event dispatch does not need to search the panel map.
+InstrumentPanel *VESSEL3_EXT::GetActivePanel() const
+{
+    InstrumentPanel *retVal = m_pActivePanel;
+    if ((retVal != nullptr) && !retVal->IsActive())
+        retVal = nullptr;     // panel was deactivated directly
+
+    return retVal;
+}
+
 // Returns the optimal (or configured) panel width to use for m_videoWindowWidth.
 // Returns: 1280, 1600, or 1920.
 int VESSEL3_EXT::Get2DPanelWidth()
@@ -281,18 +286,11 @@ void VESSEL3_EXT::WriteForced2DResolutionLogMessage(const int panelWidth) const
 // Implements VESSEL2 method
 bool VESSEL3_EXT::clbkPanelMouseEvent(int areaID, int event, int mx, int my)
 {
+    // only send this event to the ACTIVE panel
     bool wasProcessed = false;
-    InstrumentPanelIterator it = GetPanelMap().begin(); // key = panel ID, value = InstrumentPanel *
-    for (; (wasProcessed == false) && (it != m_panelMap.end()); it++)
-    {
-        // only send this event to the ACTIVE panel
-        InstrumentPanel *pPanel = it->second;
-        if (pPanel->IsActive())
-        {
-            wasProcessed = pPanel->ProcessMouseEvent(areaID, event, mx, my);
-            break;  // only one active panel, so don't bother checking the rest
-        }
-    }
+    InstrumentPanel *pPanel = GetActivePanel();
+    if (pPanel != nullptr)
+        wasProcessed = pPanel->ProcessMouseEvent(areaID, event, mx, my);
 
     return wasProcessed;
 }
@@ -301,18 +299,11 @@ bool VESSEL3_EXT::clbkPanelMouseEvent(int areaID, int event, int mx, int my)
 // Implements VESSEL2 method
 bool VESSEL3_EXT::clbkVCMouseEvent(int areaID, int event, VECTOR3 &coords)
 {
+    // only send this event to the ACTIVE panel
     bool wasProcessed = false;
-    InstrumentPanelIterator it = GetPanelMap().begin(); // key = panel ID, value = InstrumentPanel *
-    for (; (wasProcessed == false) && (it != m_panelMap.end()); it++)
-    {
-        // only send this event to the ACTIVE panel
-        InstrumentPanel *pPanel = it->second;
-        if (pPanel->IsActive())
-        {
-            wasProcessed = pPanel->ProcessVCMouseEvent(areaID, event, coords);
-            break;  // only one active panel, so don't bother checking the rest
-        }
-    }
+    InstrumentPanel *pPanel = GetActivePanel();
+    if (pPanel != nullptr)
+        wasProcessed = pPanel->ProcessVCMouseEvent(areaID, event, coords);
 
     return wasProcessed;
 }
@@ -320,20 +311,12 @@ bool VESSEL3_EXT::clbkVCMouseEvent(int areaID, int event, VECTOR3 &coords)
 // Implements VESSEL2 method
 bool VESSEL3_EXT::clbkPanelRedrawEvent(int areaID, int event, SURFHANDLE surf)
 {
-    bool wasProcessed = false;
-    InstrumentPanelIterator it = GetPanelMap().begin(); // key = panel ID, value = InstrumentPanel *
-    
     // Only send this event to the ACTIVE panel; otherwise, beyond being less efficient, if an Area 
     // object is present on more than one panel the redraw event may be incorrectly sent to the wrong panel.
-    for (; (wasProcessed == false) && (it != m_panelMap.end()); it++)
-    {
-        InstrumentPanel *pPanel = it->second;
-        if (pPanel->IsActive())
-        {
-            wasProcessed = pPanel->ProcessRedrawEvent(areaID, event, surf);
-            break;  // only one active panel, so don't bother checking the rest
-        }
-    }
+    bool wasProcessed = false;
+    InstrumentPanel *pPanel = GetActivePanel();
+    if (pPanel != nullptr)
+        wasProcessed = pPanel->ProcessRedrawEvent(areaID, event, surf);
 
     return wasProcessed;
 }
@@ -379,24 +362,28 @@ void VESSEL3_EXT::clbkPostStep(double simtDoNotUse, double simdt, double mjd)
     const double simt = GetAbsoluteSimTime();
 
     // NEW BEHAVIOR for XR1 1.3: only invoke PostSteps on the ACTIVE panel, since they should not be doing any business logic anyway.
-    InstrumentPanelIterator it = GetPanelMap().begin(); // key = panel ID, value = InstrumentPanel *
-    for (; it != GetPanelMap().end(); it++)
-    {
-        InstrumentPanel *pPanel = it->second;
-        if (pPanel->IsActive())
-        {
-            pPanel->clbkPrePostStep(simt, simdt, mjd);
-            break;      // only one active panel, so no need to keep searching
-        }
-    }
+    InstrumentPanel *pActivePanel = GetActivePanel();
+    if (pActivePanel != nullptr)
+        pActivePanel->clbkPrePostStep(simt, simdt, mjd);
 
     // invoke all registered PostStep objects
+#ifdef XR_PREPOSTSTEP_PROFILER
+    vector<PrePostStep *> &postSteps = GetPostStepVector();
+    for (int i = 0; i < static_cast<int>(postSteps.size()); i++)
+    {
+        PrePostStep *pStep = postSteps[i];
+        const LONGLONG startTicks = PrePostStepProfiler::GetTicks();
+        pStep->clbkPrePostStep(simt, simdt, mjd);
+        m_postStepProfiler.AddSample(i, pStep, PrePostStepProfiler::GetTicks() - startTicks);
+    }
+#else
     PostStepIterator it2 = GetPostStepVector().begin();
     for (; it2 != GetPostStepVector().end(); it2++)
     {
         PrePostStep *pStep = *it2;
         pStep->clbkPrePostStep(simt, simdt, mjd);
     }
+#endif
 }
 
 //
@@ -441,12 +428,36 @@ void VESSEL3_EXT::clbkPreStep(double simtDoNotUse, double simdt, double mjd)
     const double simt = GetAbsoluteSimTime();
 
     // invoke all registered PreStep objects
+#ifdef XR_PREPOSTSTEP_PROFILER
+    vector<PrePostStep *> &preSteps = GetPreStepVector();
+    for (int i = 0; i < static_cast<int>(preSteps.size()); i++)
+    {
+        PrePostStep *pStep = preSteps[i];
+        const LONGLONG startTicks = PrePostStepProfiler::GetTicks();
+        pStep->clbkPrePostStep(simt, simdt, mjd);
+        m_preStepProfiler.AddSample(i, pStep, PrePostStepProfiler::GetTicks() - startTicks);
+    }
+#else
     PreStepIterator it2 = GetPreStepVector().begin();
     for (; it2 != GetPreStepVector().end(); it2++)
     {
         PrePostStep *pStep = *it2;
         pStep->clbkPrePostStep(simt, simdt, mjd);
     }
+#endif
+}
+
+// Writes PreStep/PostStep timing statistics to our log file; does nothing unless XR_PREPOSTSTEP_PROFILER is defined.
+// Must be invoked before m_pConfig is freed.
+void VESSEL3_EXT::WritePrePostStepProfile() const
+{
+#ifdef XR_PREPOSTSTEP_PROFILER
+    if (m_pConfig == nullptr)
+        return;
+
+    m_preStepProfiler.WriteReport(*m_pConfig);
+    m_postStepProfiler.WriteReport(*m_pConfig);
+#endif
 }
 
 #if 0  // NOT IMPLEMENTED BECAUSE THIS CANNOT YET HANDLE FULL-SCREEN MODES : NOTE: we will not need this now, but let's keep the code in case we need to parse Orbiter.cfg later for any reason (sample code).
@@ -553,23 +564,27 @@ const XRGrappleTargetVessel *VESSEL3_EXT::GetGrappleTargetVessel(const char *pTa
     // locate the vessel
     // Must cast away constness here until Martin fixes the API
     const OBJHANDLE hVessel = oapiGetVesselByName(const_cast<char *>(pTargetVesselName));  // will be nullptr if vessel does not exist
-    const string sTargetVesselName(pTargetVesselName);   // temporary copy used for lookups
+    // Note: the vessel name lookup in the core is case-insensitive, and so is our cache, so the caller's name finds the same
+    // cache entry whether or not the vessel still exists.
+    const string_view targetVesselName(pTargetVesselName);
 
     if (oapiIsVessel(hVessel))    // vessel is still valid?
     {
+        VESSEL *pTargetVessel = oapiGetVesselInterface(hVessel);  // will never be null
+
         // look up the XRGrappleTargetVessel in the cache
         // WARNING: it is possible that a DIFFERENT VESSEL WITH THE SAME NAME AS AN OLD VESSEL is occurring here!  
         // If that is the case the cache will contain stale data for it, so we have to double-check the handle.
-        auto it = m_grappleTargetMap.find(&sTargetVesselName);
+        auto it = m_grappleTargetMap.find(targetVesselName);
         if (it == m_grappleTargetMap.end())
         {
 reload:
             // not in cache yet; instantiate it
-            VESSEL *pTargetVessel = oapiGetVesselInterface(hVessel);  // will never be null
             pRetVal = new XRGrappleTargetVessel(*pTargetVessel, *this);
 
             // add it to cache; it will be updated below this 'if' block
-            m_grappleTargetMap.insert(str_XRGrappleTargetVessel_Pair(new string(pTargetVesselName), pRetVal));   // the string is freed by us when we free the map
+            // Note: the key references pRetVal's own copy of the vessel name, which lives as long as pRetVal does.
+            m_grappleTargetMap.insert(str_XRGrappleTargetVessel_Pair(pRetVal->GetTargetVesselName(), pRetVal));
         }
         else    // vessel is in cache
         {
@@ -579,12 +594,11 @@ reload:
             // The reason we check for both is because Orbiter sometimes creates a new vessel using the same HANDLE as an old (now-deleted) vessel.
             const OBJHANDLE hCachedVessel = pRetVal->GetTargetHandle();
             const VESSEL *pCachedVessel = pRetVal->GetTargetVessel();
-            const VESSEL *pCurrentVessel = oapiGetVesselInterface(hVessel);  // will always succeed because handle is valid
-            if ((pCachedVessel != pCurrentVessel) || (hCachedVessel != hVessel))
+            if ((pCachedVessel != pTargetVessel) || (hCachedVessel != hVessel))
             {
                 // cache is stale!
                 // free the map elements
-                EraseIteratorItemFirstSecond(m_grappleTargetMap, it);
+                EraseIteratorItemSecond(m_grappleTargetMap, it);
                 goto reload;     // reload the cache element for this vessel
             }
         }
@@ -596,11 +610,11 @@ reload:
             // target vessel deleted!
             // remove from cache since it is invalid now 
             // NOTE: we must keep the cache clean since it is possible for a *future* vessel to have the same handle!
-            auto it = m_grappleTargetMap.find(&sTargetVesselName);
+            auto it = m_grappleTargetMap.find(targetVesselName);
             if (it != m_grappleTargetMap.end()) // should always succeed
             {
                 // free the map elements
-                EraseIteratorItemFirstSecond(m_grappleTargetMap, it);
+                EraseIteratorItemSecond(m_grappleTargetMap, it);
             }
 
             pRetVal = nullptr;  // object is invalid
@@ -610,11 +624,11 @@ reload:
     {
         // remove from cache since it is invalid now 
         // NOTE: we must keep the cache clean since it is possible for a *future* vessel to have the same handle!
-        auto it = m_grappleTargetMap.find(&sTargetVesselName);
+        auto it = m_grappleTargetMap.find(targetVesselName);
         if (it != m_grappleTargetMap.end())     // in cache?
         {
             // free the map elements
-            EraseIteratorItemFirstSecond(m_grappleTargetMap, it);
+            EraseIteratorItemSecond(m_grappleTargetMap, it);
         }
     }
 
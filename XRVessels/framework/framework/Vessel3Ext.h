@@ -33,6 +33,7 @@
 #include "PropType.h"
 #include "VesselConfigFileParser.h"
 #include "RegKeyManager.h"
+#include "PrePostStepProfiler.h"
 
 #include <unordered_map>
 #include <vector>
@@ -99,6 +100,7 @@ public:
     vector<PrePostStep *> &GetPostStepVector() { return m_postStepVector; }
     vector<PrePostStep *>  &GetPreStepVector()  { return m_preStepVector; }
     void DeactivateAllPanels();
+    InstrumentPanel *GetActivePanel() const;
     Area *GetArea(const int panelID, const int areaID);
     bool HasFocus() const { return m_hasFocus; }   // returns true if we have the focus, false if not
 
@@ -199,6 +201,10 @@ public:
     static int ResetAllFuelLevels(VESSEL *pVessel, const double levelFrac);
     static float ComputeVariableVolume(const double minVolume, const double maxVolume, double level);
 
+    // Writes PreStep/PostStep timing statistics to our log file; does nothing unless XR_PREPOSTSTEP_PROFILER is defined.
+    // Must be invoked before m_pConfig is freed.
+    void WritePrePostStepProfile() const;
+
     // data
     MESHHANDLE exmesh_tpl;        // Note: this is the *template*, so this is a *MESHHANDLE*, not a *DEVMESHHANDLE*
     VesselConfigFileParser *m_pConfig;  // our configuration file parser
@@ -214,9 +220,10 @@ protected:
 
     unordered_map<int, InstrumentPanel *> &GetPanelMap() { return m_panelMap; }  // returns map of all panels in this ship
 
-    // map of our XRGrappleTargetVessels: key=vessel name, value=XRGrappleTargetVessel itself
-    typedef unordered_map<const string *, XRGrappleTargetVessel *, stringhasher, stringhasher> HASHMAP_STR_XRGRAPPLETARGETVESSEL;
-	typedef pair<const string *, XRGrappleTargetVessel *> str_XRGrappleTargetVessel_Pair;
+    // map of our XRGrappleTargetVessels: key=vessel name (case-insensitive, like Orbiter's vessel name lookup), value=XRGrappleTargetVessel itself
+    // Note: each key references the vessel name owned by its XRGrappleTargetVessel value, so lookups never allocate.
+    typedef unordered_map<string_view, XRGrappleTargetVessel *, caseless_stringhasher, caseless_stringhasher> HASHMAP_STR_XRGRAPPLETARGETVESSEL;
+	typedef pair<string_view, XRGrappleTargetVessel *> str_XRGrappleTargetVessel_Pair;
 
     HASHMAP_STR_XRGRAPPLETARGETVESSEL m_grappleTargetMap;
 
@@ -229,9 +236,12 @@ private:
     HMODULE m_hModule;
     bool m_hasFocus;                             // true if we are in focus (i.e., we are the active ship), false if not
     unordered_map<int, InstrumentPanel *> m_panelMap; // map of all instrument panels: key = (panelWidth * 1000) + panel ID, value = InstrumentPanel *
+    InstrumentPanel *m_pActivePanel;             // panel activated by the last successful clbkLoadPanel; nullptr = none
     vector<PrePostStep *> m_postStepVector;      // list of PrePostStep objects; may be empty
     vector<PrePostStep *> m_preStepVector;       // list of PrePostStep objects; may be empty
     double m_absoluteSimTime;                    // linear simulation time since simulation start, ignoring any MJD changes (edits)
+    PrePostStepProfiler m_preStepProfiler;       // only populated if XR_PREPOSTSTEP_PROFILER is defined
+    PrePostStepProfiler m_postStepProfiler;      // only populated if XR_PREPOSTSTEP_PROFILER is defined
 };
 
 //---------------------------------------------------------------------------
@@ -29,7 +29,7 @@
 
 // Constructor
 XRGrappleTargetVessel::XRGrappleTargetVessel(VESSEL &targetVessel, VESSEL3_EXT &parentVessel) :
-    m_pTargetVessel(&targetVessel), m_parentVessel(parentVessel), m_prevSimt(-1),
+    m_pTargetVessel(&targetVessel), m_targetVesselName(targetVessel.GetName()), m_parentVessel(parentVessel), m_prevSimt(-1),
     m_deltaV(0), m_distance(0), m_prevRetVal(true), m_lastComputedDeltaVSimt(-1), m_lastComputedDeltaVDistance(-1),
     m_isLastComputedValid(false)
 {
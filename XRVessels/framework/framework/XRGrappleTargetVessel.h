@@ -41,6 +41,7 @@ public:
 
     VESSEL *GetTargetVessel() const { return m_pTargetVessel; } // nullptr = "target invalid"; will never be null if IsStateDataValid() == true.
     OBJHANDLE GetTargetHandle() const { return m_hTargetHandle; }
+    const string &GetTargetVesselName() const { return m_targetVesselName; }  // vessel name at the time this object was constructed
     const XRPayloadClassData &GetTargetPCD() const { return *m_targetPCD; }
     double GetDeltaV() const        { return m_deltaV; }        // may by positive or negative
     double GetDistance() const      { return m_distance; }      // -1 = "unknown"
@@ -52,6 +53,7 @@ public:
 protected:
     VESSEL *m_pTargetVessel;
     OBJHANDLE m_hTargetHandle;
+    const string m_targetVesselName;
     VESSEL3_EXT &m_parentVessel;
     const XRPayloadClassData *m_targetPCD;
     bool m_prevRetVal;
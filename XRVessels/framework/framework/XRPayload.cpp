@@ -27,10 +27,14 @@
 #include "XRPayload.h"
 #include "VesselAPI.h"
 #include "XRPayloadBay.h"
-#include "FileList.h"
+#include "XRPayloadCfgScanner.h"
+#include "ConfigFileParser.h"
 #include <string>
 #include <string.h>
 
+// on-disk index of parsed .cfg data, relative to the Orbiter root directory; shared by all XR vessels
+#define XRPAYLOAD_INDEX_FILESPEC "XRPayloadIndex.dat"
+
 // define static data
 HASHMAP_STR_XRPAYLOAD XRPayloadClassData::s_classnameToXRPayloadClassDataMap;
 const XRPayloadClassData **XRPayloadClassData::s_allXRPayloadEnabledClassData = nullptr;
@@ -58,7 +62,7 @@ const XRPayloadClassData &XRPayloadClassData::GetXRPayloadClassDataForClassname(
     XRPayloadClassData *pRetVal = nullptr;
 
     // pull the data from cache, which was already pre-populated with all .cfg files in the system
-    auto it = s_classnameToXRPayloadClassDataMap.find(&string(pClassname));
+    auto it = s_classnameToXRPayloadClassDataMap.find(pClassname);
     if (it != s_classnameToXRPayloadClassDataMap.end())
     {
         // object is in cache: return it
@@ -67,7 +71,7 @@ const XRPayloadClassData &XRPayloadClassData::GetXRPayloadClassDataForClassname(
     else   // something goofy is going on: there is no .cfg for this vessel under Config\Vessels
     {
         // return the default PCD 
-        pRetVal = s_classnameToXRPayloadClassDataMap.find(&string(XRPAYLOAD_BAY_CLASSNAME))->second;  // will always succeed
+        pRetVal = s_classnameToXRPayloadClassDataMap.find(XRPAYLOAD_BAY_CLASSNAME)->second;  // will always succeed
     }
 
     return *pRetVal;
@@ -83,163 +87,91 @@ void XRPayloadClassData::Terminate()
     for (; it != s_classnameToXRPayloadClassDataMap.end(); it++)
     {
         // NOTE: no reason to invoke erase() on the individual map items: they will be freed along with the hashmap object
-        const string *pClassname = it->first;
+        // The key references the object's own classname, so there is nothing else to free here.
         const XRPayloadClassData *pObj = it->second;
-
-        delete pClassname;   
         delete pObj;
     }
+    s_classnameToXRPayloadClassDataMap.clear();     // keys are now dangling
 
     // delete the static s_allXRPayloadEnabledClassData array
     delete s_allXRPayloadEnabledClassData;      // do not use 'delete []' here; objects in the array were already freed above
 }
 
 // Payload vessles MUST invoke this static method before the simulation begins (typically from clbkPostCreation) so that all Orbiter vessel .cfg files are parsed.
-void XRPayloadClassData::InitializeXRPayloadClassData()
+// pLog = log to which the scan statistics are written; may be null
+void XRPayloadClassData::InitializeXRPayloadClassData(const ConfigFileParser *pLog)
 {
     // don't re-scan for .cfg files more than once per simulation startup (it is unnecessary, and scanning is somewhat expensive)
     if (s_classnameToXRPayloadClassDataMap.size() > 0)
         return;   // we already parsed the config files and data is static, so nothing more to do
 
-    // Custom FileList scanner to process .cfg files here
-    class CfgFileList : public FileList
-    {
-    public:
-        CfgFileList() : FileList("Config\\Vessels", true, ".cfg")
-        {
-        }
+    // recursively iterate through $ORBITER_HOME\Config\Vessels\... and parse each .cfg file for XRPayload data; 
+    // unchanged files since the last scan are pulled from our on-disk index instead
+    XRPayloadCfgScanner scanner("Config\\Vessels", XRPAYLOAD_INDEX_FILESPEC);
+    scanner.Scan();
 
-    protected:
-        // Callback invoked for non-empty .cfg files.
-        virtual void clbkProcessFile(const char *pConfigFilespec, const WIN32_FIND_DATA &fd) override
-        {
-            char pClassname[MAX_PATH];
-            const int configVesselsPathPrefixLength = 15;     // "Config\Vessels\"
-            // first, skip the leading "Config\Vessels\" in pConfigFilespec (e.g., "Config\Vessels\UCGO\foo.cfg")
-            // The vessel's classname is everything between the leading prefix and the trailing ".cfg";
-            // e.g., "UCGO\foo.cfg".
-            const size_t classnameLength = strlen(pConfigFilespec) - configVesselsPathPrefixLength - 4;  // don't copy trailing ".cfg" either (4 bytes)
-            strncpy(pClassname, pConfigFilespec + configVesselsPathPrefixLength, classnameLength);
-            pClassname[classnameLength] = 0;  // zero-terminate string
-
-            // Found a .cfg file, so create a new XRPayloadClassData for it and save it to our master s_classnameToXRPayloadClassDataMap.
-            // Note that ALL vessels get a XRPayloadClassData object, even if they are not XRPayload-enabled.
-            // NOTE: XRPayloadClassData requires a path relative to $ORBITER_ROOT\Config, so we have to skip over the leading "Config\" in pConfigFilespec here.
-            const char *pConfigRelativePath = pConfigFilespec + 7;   // skip leanding "Config\"
-            XRPayloadClassData *pPCD = new XRPayloadClassData(pConfigRelativePath, pClassname);
-
-            // Now add it to the system-wide cache
-            typedef pair<const string *, XRPayloadClassData *> Str_XRPayload_Pair;
-            s_classnameToXRPayloadClassDataMap.insert(Str_XRPayload_Pair(new string(pClassname), pPCD));  // key = ship classname, value=XRPayloadClassData for that vessel class
-        }
-    };
+    for (const XRPayloadCfgScanner::Entry &entry : scanner.GetEntries())
+    {
+        // Create a new XRPayloadClassData for this .cfg file and save it to our master s_classnameToXRPayloadClassDataMap.
+        // Note that ALL vessels get a XRPayloadClassData object, even if they are not XRPayload-enabled.
+        // NOTE: XRPayloadClassData requires a path relative to $ORBITER_ROOT\Config, so we have to skip over the leading "Config\" in configFilespec here.
+        const char *pConfigRelativePath = entry.configFilespec.c_str() + 7;   // skip leanding "Config\"
+        XRPayloadClassData *pPCD = new XRPayloadClassData(pConfigRelativePath, entry.classname.c_str(), entry.data);
+
+        // Now add it to the system-wide cache
+        // Note: the key references pPCD's own copy of the classname, which lives as long as pPCD does.
+        typedef pair<string_view, XRPayloadClassData *> Str_XRPayload_Pair;
+        s_classnameToXRPayloadClassDataMap.insert(Str_XRPayload_Pair(pPCD->GetClassname(), pPCD));  // key = ship classname, value=XRPayloadClassData for that vessel class
+    }
 
-    // recursively iterate through $ORBITER_HOME\Config\Vessels\... and parse each .cfg file for XRPayload data
-    CfgFileList FileList;
-    FileList.Scan();    // invokes our clbkProcessFile method above for each .cfg file found
+    _ASSERTE(!scanner.GetEntries().empty());  // should have at least our XRPayloadBay.cfg in the list, plus the other vessels
 
-    _ASSERTE(!FileList.GetScannedFilesList().empty());  // should have at least our XRPayloadBay.cfg in the list, plus the other vessels
+    if (pLog != nullptr)
+    {
+        static char msg[256];
+        sprintf(msg, "XRPayload scan of Config\\Vessels: %d .cfg files in %.1lf ms (%d parsed using %d thread(s), %d unchanged from index)",
+            static_cast<int>(scanner.GetEntries().size()), scanner.GetElapsedMillis(), scanner.GetParsedCount(), scanner.GetThreadCount(), scanner.GetIndexHitCount());
+        pLog->WriteLog(msg);
+    }
 }
 
 //=========================================================================
 
-// Constructor: create a new payload object from the supplied payload vessel; its config file 
-// is parsed for custom configuration data.
+// Constructor: create a new payload object from the supplied payload vessel's config file data, which 
+// was parsed by XRPayloadCfgScanner.
 // pConfigFilespec = path\filename under $ORBITER_HOME\Config of filename; e.g., "Vessels\XRParts.cfg".
 // pClassname = vessel classname to which this payload object is tied; e.g., "XRParts", "UCGO\foo", etc.
-XRPayloadClassData::XRPayloadClassData(const char *pConfigFilespec, const char *pClassname) :
+// cfgData = XRPayload settings from the vessel's config file; missing settings are already set to default values
+XRPayloadClassData::XRPayloadClassData(const char *pConfigFilespec, const char *pClassname, const XRPayloadCfgData &cfgData) :
     m_hThumbnailBitmap(nullptr)
 {
     m_pClassname = _strdup(pClassname);
     m_pConfigFilespec = _strdup(pConfigFilespec);
     
-    // set default values; these are overridden by values in the config file, if any
-    m_isXRPayloadEnabled = false;     // default is FALSE
-    m_isXRConsumableTank = false;     // default is FALSE
+    m_isXRPayloadEnabled = cfgData.isXRPayloadEnabled;
+    m_isXRConsumableTank = cfgData.isXRConsumableTank;
     m_pDescription = new char[128];
-    strcpy(m_pDescription, "Unknown");
-    m_dimensions = _V(1, 1, 1);   // UNKNOWN; should never happen!
-    m_mass = 1.0;       // should never happen!
-    m_primarySlotCenterOfMassOffset = _V(0, 0, 0);   // default to "mass centered in primary slot"
-    m_groundDeploymentAdjustment = _V(0, 0, 0);      // default to "no adjustment"
+    strncpy(m_pDescription, cfgData.description.c_str(), 127);
+    m_pDescription[127] = 0;    // in case description was truncated
+    m_dimensions = cfgData.dimensions;
+    m_mass = cfgData.mass;
+    m_primarySlotCenterOfMassOffset = cfgData.primarySlotCenterOfMassOffset;
+    m_groundDeploymentAdjustment = cfgData.groundDeploymentAdjustment;
     
     static char pThumbnailPath[1024];  // static for efficiency
     strcpy(pThumbnailPath, DEFAULT_PAYLOAD_THUMBNAIL_PATH);
+    if (!cfgData.thumbnailPath.empty())
+    {
+        strncpy(pThumbnailPath, cfgData.thumbnailPath.c_str(), sizeof(pThumbnailPath) - 1);
+        pThumbnailPath[sizeof(pThumbnailPath) - 1] = 0;
+    }
 
-    // Note: this should actually return nullptr if there is no vessel file defined in the Vessels directory
-    // for the vessel; this would be possible if the the vessel's cfg file was incorrectly installed in
-    // the Config directory instead of the correct Config\Vessels.  However, due to an Orbiter core bug
-    // (or feature?) oapiOpenFile instead creates an empty file in Config\Vessels and returns a valid handle
-    // to it.
-    FILEHANDLE hConfigFile = oapiOpenFile(m_pConfigFilespec, FILE_IN, CONFIG);  // filespec is CONFIG-relative here
-    if (hConfigFile != nullptr)  // Note: this will always be true with the current Orbiter version; this is here in case the core bug is fixed in the future
+    // explicit attachment points
+    for (const auto &slotGroup : cfgData.explicitAttachmentSlots)
     {
-        oapiReadItem_bool  (hConfigFile, "XRPayloadEnabled", m_isXRPayloadEnabled);
-        oapiReadItem_string(hConfigFile, "Description", m_pDescription);
-        oapiReadItem_vec   (hConfigFile, "Dimensions", m_dimensions);
-        oapiReadItem_float (hConfigFile, "Mass", m_mass);
-        // NOTE: no longer used: oapiReadItem_int   (hConfigFile, "AttachmentPointIndex", m_attachmentPointIndex);
-        oapiReadItem_bool  (hConfigFile, "XRConsumableTank", m_isXRConsumableTank);
-        oapiReadItem_vec   (hConfigFile, "PrimarySlotCenterOfMassOffset", m_primarySlotCenterOfMassOffset);
-        oapiReadItem_string(hConfigFile, "ThumbnailPath", pThumbnailPath);
-        oapiReadItem_vec   (hConfigFile, "GroundDeploymentAdjustment", m_groundDeploymentAdjustment);
-
-        // explicit attachment points
-        static char vesselsWithExplicitAttachmentSlotsDefined[2048];  // static for efficiency
-        if (oapiReadItem_string(hConfigFile, "VesselsWithExplicitAttachmentSlotsDefined", vesselsWithExplicitAttachmentSlotsDefined))
-        {
-            // slot data exists for at least one vessel
-            // Note: we cannot use strtok here in the outer loop, and it's a pain working with the 'string' class, so we'll just
-            // parse it ourselves.
-            char *pVesselClassname = vesselsWithExplicitAttachmentSlotsDefined;
-            while ((*pVesselClassname == ' ') && (*pVesselClassname != 0))
-                pVesselClassname++; // skip whitespace
-
-            bool bExitClassLoop = false;   
-            while ((*pVesselClassname != 0) && (bExitClassLoop == false))
-            {
-                char *pEnd;  // reused
-
-                // locate the next space and zero-terminate on it
-                for (pEnd = pVesselClassname; *pEnd != 0; pEnd++)
-                {
-                    if (*pEnd == ' ')
-                        break;
-                }
-                if (*pEnd == 0)
-                    bExitClassLoop = true;      // this is the last pass
-
-                // we found a space, so zero-terminate on it
-                *pEnd = 0;
-
-                // retrieve the 'ExplicitAttachmentSlots' string of numbers for this vessel
-                static char explicitAttachmentSlotsStr[1024];  // static for efficiency
-                char prefName[512];
-                sprintf(prefName, "%s_ExplicitAttachmentSlots", pVesselClassname);    // e.g., "XR5Vanguard_ExplicitAttachmentSlots"
-                if (oapiReadItem_string(hConfigFile, prefName, explicitAttachmentSlotsStr))
-                {
-                    // slot data defined; parse out the space-delimited slot integer values and add each one to our new object
-                    char *pSlotInt = strtok(explicitAttachmentSlotsStr, " ");
-                    while (pSlotInt != nullptr)
-                    {
-                        // convert to an integer and save it in our new payload object
-                        int slotNumber = atoi(pSlotInt);
-                        if (slotNumber > 0)
-                            AddExplicitAttachmentSlot(pVesselClassname, slotNumber);    // slot number is valid
-
-                        pSlotInt = strtok(nullptr, " ");   // read next slot value
-                    }
-                }
-
-                // find the next token, which was replaced with zero, and move just beyond it for the next loop
-                while (*pVesselClassname != 0)
-                    pVesselClassname++;  // separate line for clarity
-                pVesselClassname++;      // skip the zero
-            }
-        }
-        // clean up
-        oapiCloseFile(hConfigFile, FILE_IN);
-    }  // if (hConfigFile != nullptr)
+        for (const int slotNumber : slotGroup.second)
+            AddExplicitAttachmentSlot(slotGroup.first.c_str(), slotNumber);
+    }
 
     // compute the # of slots occupied based on the dimensions (assigned by value)
     m_slotsOccupied = _V(m_dimensions.x / PAYLOAD_SLOT_DIMENSIONS.x,
@@ -271,17 +203,9 @@ XRPayloadClassData::~XRPayloadClassData()
     
     delete m_pDescription;
 
-    // free up the map
-    auto it = m_explicitAttachmentSlotsMap.begin();
-    for (; it != m_explicitAttachmentSlotsMap.end(); it++)
-    {
-        // NOTE: no reason to invoke erase() on the individual map items: they will be freed along with the hashmap object
-        const string *pMapShipClassname = it->first;
-        vector<int> *pSlotList = it->second;
-
-        delete pMapShipClassname;   
-        delete pSlotList;
-    }
+    // Note: the map's keys reference the strings we free here, but the map itself is never used again
+    for (auto &entry : m_explicitAttachmentSlotsMap)
+        delete entry.second;
 
     // free the thumbnail bitmap, if any
     if (m_hThumbnailBitmap != nullptr)
@@ -294,32 +218,20 @@ XRPayloadClassData::~XRPayloadClassData()
 // slotNumber = slot number in the parent ship's bay to which this object may attach.
 void XRPayloadClassData::AddExplicitAttachmentSlot(const char *pParentVesselClassname, int slotNumber)
 {
-    vector<int> *pSlotList = nullptr;  // assume not found
-    
-    auto it = m_explicitAttachmentSlotsMap.find(&string(pParentVesselClassname));
-    
-    // did we find an existing slot list of the specified vessel class?
-    if (it != m_explicitAttachmentSlotsMap.end())
+    // key = ship classname, value = slot numbers; create an empty slot list for this vessel class if it is not in the map yet
+    auto it = m_explicitAttachmentSlotsMap.find(pParentVesselClassname);
+    if (it == m_explicitAttachmentSlotsMap.end())
     {
-        // add this slot number to the existing vector
-        vector<int> *pSlotList = it->second;
-        pSlotList->push_back(slotNumber);
-    }
-    else    
-    {
-        // map is empty; clone the incoming ship classname and create a new vector to hold its slot numbers
-        vector<int> *pVec = new vector<int>();
-        pVec->push_back(slotNumber);    // this is the first and only entry for now
-
-        typedef pair<const string *, vector<int> *> Str_Vec_Pair;
-        m_explicitAttachmentSlotsMap.insert(Str_Vec_Pair(new string(pParentVesselClassname), pVec));  // key = ship classname, value=vector<int> slot numbers
+        ExplicitAttachmentSlots *pSlots = new ExplicitAttachmentSlots(pParentVesselClassname);
+        it = m_explicitAttachmentSlotsMap.insert(HASHMAP_STR_EXPLICITSLOTS::value_type(pSlots->parentVesselClassname, pSlots)).first;
     }
+    it->second->slotNumbers.push_back(slotNumber);
 }
 
 // Returns true if any explicit bay slots are defined for the specified vessel classname.
 bool XRPayloadClassData::AreAnyExplicitAttachmentSlotsDefined(const char *pParentVesselClassname) const
 {
-    auto it = m_explicitAttachmentSlotsMap.find(&string(pParentVesselClassname));
+    auto it = m_explicitAttachmentSlotsMap.find(pParentVesselClassname);
     return (it != m_explicitAttachmentSlotsMap.end());
 }
 
@@ -328,14 +240,14 @@ bool XRPayloadClassData::IsExplicitAttachmentSlotAllowed(const char *pParentVess
 {
     bool retVal = true;     // assume vessel not found
 
-    auto it = m_explicitAttachmentSlotsMap.find(&string(pParentVesselClassname));
+    auto it = m_explicitAttachmentSlotsMap.find(pParentVesselClassname);
     if (it != m_explicitAttachmentSlotsMap.end())
     {
         retVal = false;     // slot denied now unless explicitly found in the slot list below
 
-        vector<int> *pSlotList = it->second;
+        const vector<int> &slotList = it->second->slotNumbers;
         // walk through all the slot numbers valid for this vessel class
-        for (vector <int>::iterator slotIT = pSlotList->begin(); slotIT != pSlotList->end(); slotIT++)
+        for (vector<int>::const_iterator slotIT = slotList.begin(); slotIT != slotList.end(); slotIT++)
         {
             if (slotNumber == *slotIT)
             {
@@ -362,7 +274,7 @@ const XRPayloadClassData **XRPayloadClassData::GetAllAvailableXRPayloads()
         VECTOR_XRPAYLOAD allXRPayloads;
 
         // Walk through each XRPayloadClassData in our s_classnameToXRPayloadClassDataMap and copy all XRPayload-enabled ones to our master s_allXRPayloadEnabledClassData 
-        unordered_map<const string *, XRPayloadClassData *>::const_iterator it = s_classnameToXRPayloadClassDataMap.begin();  // iterate over values
+        HASHMAP_STR_XRPAYLOAD::const_iterator it = s_classnameToXRPayloadClassDataMap.begin();  // iterate over values
         for (; it != s_classnameToXRPayloadClassDataMap.end(); it++)
         {
             const XRPayloadClassData *pPCD = it->second;  // get next PCD
@@ -40,12 +40,25 @@ extern const VECTOR3 &PAYLOAD_SLOT_DIMENSIONS;
 extern const char *DEFAULT_PAYLOAD_THUMBNAIL_PATH;
 
 class XRPayloadClassData;
+class ConfigFileParser;
+struct XRPayloadCfgData;
 
-// hashmap: string -> vector of integers 
-typedef unordered_map<const string *, vector<int> *, stringhasher, stringhasher> HASHMAP_STR_VECINT;
+// bay slots to which a payload may attach in a given parent vessel class
+struct ExplicitAttachmentSlots
+{
+    ExplicitAttachmentSlots(const char *pParentVesselClassname) : parentVesselClassname(pParentVesselClassname) { }
+
+    const string parentVesselClassname;
+    vector<int> slotNumbers;
+};
+
+// hashmap: parent vessel classname -> ExplicitAttachmentSlots object
+// Note: each key references the classname string owned by its ExplicitAttachmentSlots value, so lookups never allocate.
+typedef unordered_map<string_view, ExplicitAttachmentSlots *, stringhasher, stringhasher> HASHMAP_STR_EXPLICITSLOTS;
 
 // hashmap: string -> XRPayload object
-typedef unordered_map<const string *, XRPayloadClassData *, stringhasher, stringhasher> HASHMAP_STR_XRPAYLOAD;
+// Note: each key references the classname string owned by its XRPayloadClassData value, so lookups never allocate.
+typedef unordered_map<string_view, XRPayloadClassData *, stringhasher, stringhasher> HASHMAP_STR_XRPAYLOAD;
 
 // vector of XRPayloadClassData objects
 typedef vector<const XRPayloadClassData *> VECTOR_XRPAYLOAD;
@@ -62,7 +75,7 @@ class XRPayloadClassData
 public:
     static const XRPayloadClassData &GetXRPayloadClassDataForClassname(const char *pClassname);
     static void Terminate();  // clients should invoke this from their ExitModule method
-    static void InitializeXRPayloadClassData();  // clients must invoke this from a one-shot PostStep one second after the simulation starts so that all XR payload vessels are loaded
+    static void InitializeXRPayloadClassData(const ConfigFileParser *pLog = nullptr);  // clients must invoke this from a one-shot PostStep one second after the simulation starts so that all XR payload vessels are loaded
     static const XRPayloadClassData **GetAllAvailableXRPayloads();  // returns all XRPayloads available in the config\vessels directory
     static ATTACHMENTHANDLE GetAttachmentHandleForPayloadVessel(const VESSEL &childVessel);
     static double getLongestYTouchdownPoint(const VESSEL &vessel);
@@ -96,7 +109,7 @@ protected:
     VECTOR3 m_slotsOccupied;    // width (X), height (Y), length (Z)
     VECTOR3 m_primarySlotCenterOfMassOffset;  // X,Y,Z
     HBITMAP m_hThumbnailBitmap; // will be nullptr if bitmap is no defined or is invalid
-    HASHMAP_STR_VECINT m_explicitAttachmentSlotsMap;   // key=vessel classname, value=list of ship bay slots to which this object may attach (assuming sufficient room).    
+    HASHMAP_STR_EXPLICITSLOTS m_explicitAttachmentSlotsMap;   // key=vessel classname, value=list of ship bay slots to which this object may attach (assuming sufficient room).    
     bool m_isXRPayloadEnabled;  // true if this vessel is enabled for docking in the bay, false otherwise
     bool m_isXRConsumableTank;  // true if this vessel contains XR fuel consumable by the parent ship.
     double m_mass;              // nominal mass
@@ -105,7 +118,7 @@ protected:
 private:
     // NOTE: these are 'private' by design to prevent incorrect instantiation: all client code should go through
     // the static GetXRPayloadClassDataForClassname to retrieve XRPayloadClassData data.
-    XRPayloadClassData(const char *pConfigFilespec, const char *pClassname);
+    XRPayloadClassData(const char *pConfigFilespec, const char *pClassname, const XRPayloadCfgData &cfgData);
     virtual ~XRPayloadClassData();
     
     static HASHMAP_STR_XRPAYLOAD s_classnameToXRPayloadClassDataMap;
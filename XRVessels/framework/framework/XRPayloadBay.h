@@ -50,6 +50,9 @@ class XRPayloadBaySlot;
 // hashmap: int -> XRPayloadBaySlot object
 typedef unordered_map<int, XRPayloadBaySlot *> HASHMAP_INT_XRPAYLOADBAYSLOT;
 
+// set of payload bay slots: bit (slotNumber-1) represents each slot
+typedef unsigned __int64 SLOTMASK;
+
 // Base XRPayload bay class that each XR vessel should extend or use
 class XRPayloadBay
 {
@@ -63,6 +66,19 @@ public:
         vector<int> filledList;   // slot indexes are from 1...n
     };
 
+    // maximum number of slots in a bay; limited by the width of SLOTMASK
+    static const int MAX_SLOT_COUNT = 64;
+
+    // number of propellant types that may be stored in the bay: PT_Main, PT_SCRAM, and PT_LOX
+    static const int BAY_PROPELLANT_TYPE_COUNT = 3;
+
+    // totals for all propellant types in all bay slots; index = static_cast<int>(PROP_TYPE)
+    struct BayPropellantSnapshot
+    {
+        double mass[BAY_PROPELLANT_TYPE_COUNT];     // current quantity in kg
+        double maxMass[BAY_PROPELLANT_TYPE_COUNT];  // capacity in kg
+    };
+
     XRPayloadBay(VESSEL &parentVessel);
     virtual ~XRPayloadBay();
 
@@ -91,10 +107,18 @@ public:
     int GetSlotCount() const                 { return static_cast<int>(m_allSlotsMap.size()); }
     VESSEL &GetParentVessel() const          { return m_parentVessel; }
 
+    // slot occupancy
+    static SLOTMASK GetSlotMask(const int slotNumber) { return (static_cast<SLOTMASK>(1) << (slotNumber - 1)); }
+    SLOTMASK GetOccupiedSlotMask() const;
+    void InvalidateOccupiedSlotMask() { m_occupiedSlotMaskSimt = -1; }  // forces the next GetOccupiedSlotMask call to walk the bay again
+    int GetFreeSlotsForPayload(const VESSEL &childVessel, vector<int> &slotNumbersOut) const;
+
     // fuel/lox management
     double GetPropellantMaxMass(const PROP_TYPE propType) const;
     double GetPropellantMass(const PROP_TYPE propType) const;
     const SlotsDrainedFilled &AdjustPropellantMass(const PROP_TYPE propType, const double quantityRequested);
+    const BayPropellantSnapshot &GetPropellantSnapshot() const;
+    void InvalidatePropellantSnapshot() { m_propellantSnapshotSimt = -1; }  // forces the next GetPropellantSnapshot call to walk the bay again
 
     // virtual methods
     
@@ -111,4 +135,8 @@ protected:
     // map of slots numbers -> slot data: key=(int) slot #, value=(XRPayloadBaySlot) data
     HASHMAP_INT_XRPAYLOADBAYSLOT m_allSlotsMap;
     SlotsDrainedFilled m_slotsDrainedFilled;  // only updated by AdjustPropellantMass
+    mutable BayPropellantSnapshot m_propellantSnapshot;  // cached by GetPropellantSnapshot
+    mutable double m_propellantSnapshotSimt;  // absolute simt at which m_propellantSnapshot was computed; -1 = invalid
+    mutable SLOTMASK m_occupiedSlotMask;      // cached by GetOccupiedSlotMask
+    mutable double m_occupiedSlotMaskSimt;    // absolute simt at which m_occupiedSlotMask was computed; -1 = invalid
 };
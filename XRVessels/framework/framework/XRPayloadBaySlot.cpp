@@ -48,6 +48,8 @@ XRPayloadBaySlot::XRPayloadBaySlot(const int slotNumber, const VECTOR3 &localCoo
     for (int i=0; i < 6; i++)
         m_neighbors[i] = nullptr;
 
+    InvalidateChildPropellantCache();
+
     // create an attachment point on our parent vessel: attachment point is in the *center* of the slot
     m_hAttachmentHandle = parentBay.GetParentVessel().CreateAttachment(false, localCoordinates, _V(0, -1.0, 0), _V(0, 0, 1.0), "XRCARGO");
 }
@@ -77,7 +79,10 @@ bool XRPayloadBaySlot::AttachChild(VESSEL &childVessel)
 
     // if the attach succeeded, refresh the slot states in the bay
     if (retVal)
+    {
+        InvalidateChildPropellantCache();    // new child
         GetParentBay().RefreshSlotStates();  // enable/disable slots based on payload in bay
+    }
 
     return retVal;
 }
@@ -97,7 +102,10 @@ bool XRPayloadBaySlot::DetachChild(const double deltaV)
 
     // if the detach succeeded, refresh the slot states in the bay
     if (retVal)
+    {
+        InvalidateChildPropellantCache();    // child is gone
         GetParentBay().RefreshSlotStates();  // enable/disable slots based on payload in bay
+    }
 
     return retVal;
 }
@@ -124,7 +132,8 @@ VESSEL *XRPayloadBaySlot::GetChild() const
 bool XRPayloadBaySlot::CheckSlotSpace(const VESSEL &childVessel) const
 {
     // verify that this (the primary slot) is free
-    if ((GetChild() != nullptr) || (IsEnabled() == false))
+    const SLOTMASK occupiedSlotMask = GetParentBay().GetOccupiedSlotMask();
+    if (occupiedSlotMask & GetSlotMask())
         return false;   // slot occupied!
 
     // If explicit attachment slots are defined for this child object, ignore hull boundary checks and only check for other attached payloads.
@@ -146,27 +155,46 @@ bool XRPayloadBaySlot::CheckSlotSpace(const VESSEL &childVessel) const
     }
 
     // This slot (the primary slot) is OK; retrieve the surrounding slots occupied by this candidate vessel.
-    vector<const XRPayloadBaySlot *> vOut;  
-    bool childClearsHull = GetRequiredNeighborSlotsForCandidateVessel(childVessel, vOut);  // if 'true', the child clears the hull; if 'false', the child IMPACTS the hull
+    const Footprint footprint = GetFootprint(childVessel);
 
     // If the child impacts the hull, we may ignore it ONLY if "explicit attachment slot" mode is enabled, which assumes that the vessel mesh was explicitly 
     // taylored to fit in this slot.
-    if ((childClearsHull == false) && (isExplicitAttachmentSlot == false))
+    if ((footprint.clearsHull == false) && (isExplicitAttachmentSlot == false))
         return false;       // child vessel would impact the hull edge and explicit-latch is not set!
 
-    // If we reach here, the child will clear the hull!  Let's check the neighboring slots next...
+    // If we reach here, the child will clear the hull!  Each neighbor slot the child would occupy must be FREE in order for this candidate vessel to fit.
+    return ((footprint.slotMask & occupiedSlotMask) == 0);
+}
+
+// Returns the slots the supplied candidate vessel would occupy if it were attached in this slot, including this slot.
+// Note that we do not check whether the slots are *occupied*.
+// The sweep is only performed the first time a given payload class is checked in this slot; after that the footprint comes from our cache.
+XRPayloadBaySlot::Footprint XRPayloadBaySlot::GetFootprint(const VESSEL &childVessel) const
+{
+    Footprint retVal = { GetSlotMask(), true };
 
-    // Iterate through each neighbor slot occupied; each occupied neighbor slot 
-    // must be be FREE in order for this candidate vessel to fit.
-    for (UINT i=0; i < vOut.size(); i++)
+    // same as GetRequiredNeighborSlotsForCandidateVessel: if the child has no attachment point, assume it needs this slot only and that the edge is OK, too
+    if (XRPayloadClassData::GetAttachmentHandleForPayloadVessel(childVessel) == nullptr)
+        return retVal;
+
+    const XRPayloadClassData *pPCD = &XRPayloadClassData::GetXRPayloadClassDataForClassname(childVessel.GetClassName());
+    auto it = m_footprintCache.find(pPCD);
+    if (it != m_footprintCache.end())
     {
-        const XRPayloadBaySlot *pSlot = vOut[i];
-        if ((pSlot->GetChild() != nullptr) || (pSlot->IsEnabled() == false))
-            return false;   // neighbor slot itself is occupied
+        retVal = it->second;
     }
+    else
+    {
+        // first time we have seen this payload class in this slot
+        vector<const XRPayloadBaySlot *> vOut;
+        retVal.clearsHull = GetRequiredNeighborSlotsForCandidateVessel(childVessel, vOut);
+        for (const XRPayloadBaySlot *pSlot : vOut)
+            retVal.slotMask |= pSlot->GetSlotMask();
 
-    // If we reach here, there is room to attach the candidate vessel!
-    return true;
+        m_footprintCache[pPCD] = retVal;
+    }
+
+    return retVal;
 }
 
 // Retrieve a list of all neighboring slots that would be occupied by the supplied candidate vessel.
@@ -389,6 +417,30 @@ double XRPayloadBaySlot::GetVectorValueForAxis(const NEIGHBOR neighbor, const VE
     return retVal;
 }
 
+// Returns the propellant handle for the indexed fuel tank of the child in this slot, or nullptr if the child is not an XR consumable tank
+// or has no such tank.  The child's class data and propellant handles are looked up once and then cached until a different child
+// is detected in this slot.
+// child = vessel currently attached in this slot (from GetChild())
+PROPELLANT_HANDLE XRPayloadBaySlot::GetCachedPropellantHandle(VESSEL &child, const int index) const
+{
+    const OBJHANDLE hChild = child.GetHandle();
+    if ((m_childCache.hChild != hChild) || (m_childCache.pChild != &child))
+    {
+        // new child (or the cache was invalidated): reload the cache
+        const XRPayloadClassData &pcd = XRPayloadClassData::GetXRPayloadClassDataForClassname(child.GetClassName());
+        m_childCache.hChild = hChild;
+        m_childCache.pChild = &child;
+        m_childCache.isXRConsumableTank = pcd.IsXRConsumableTank();
+        for (int i = 0; i < CACHED_PROPELLANT_COUNT; i++)
+            m_childCache.propellantHandles[i] = (m_childCache.isXRConsumableTank ? child.GetPropellantHandleByIndex(i) : nullptr);
+    }
+
+    if ((index < 0) || (index >= CACHED_PROPELLANT_COUNT))
+        return (m_childCache.isXRConsumableTank ? child.GetPropellantHandleByIndex(index) : nullptr);  // not cached; should never happen
+
+    return m_childCache.propellantHandles[index];
+}
+
 // returns the maximum capacity of the indexed fuel tank for this payload, if any is attached in this slot (0 = PropellantResource1) AND it contains XR fuel
 double XRPayloadBaySlot::GetPropellantMaxMass(const int index) const
 {
@@ -396,13 +448,9 @@ double XRPayloadBaySlot::GetPropellantMaxMass(const int index) const
     VESSEL *pChild = GetChild();
     if (pChild != nullptr)
     {
-        const XRPayloadClassData &pcd = XRPayloadClassData::GetXRPayloadClassDataForClassname(pChild->GetClassName());
-        if (pcd.IsXRConsumableTank())
-        {
-            const PROPELLANT_HANDLE ph = pChild->GetPropellantHandleByIndex(index);
-            if (ph != nullptr)
-                retVal = pChild->GetPropellantMaxMass(ph);
-        }
+        const PROPELLANT_HANDLE ph = GetCachedPropellantHandle(*pChild, index);  // will be null if child is not an XR consumable tank
+        if (ph != nullptr)
+            retVal = pChild->GetPropellantMaxMass(ph);
     }
     
     return retVal;
@@ -415,18 +463,33 @@ double XRPayloadBaySlot::GetPropellantMass(const int index) const
     VESSEL *pChild = GetChild();
     if (pChild != nullptr)
     {
-        const XRPayloadClassData &pcd = XRPayloadClassData::GetXRPayloadClassDataForClassname(pChild->GetClassName());
-        if (pcd.IsXRConsumableTank())
-        {
-            const PROPELLANT_HANDLE ph = pChild->GetPropellantHandleByIndex(index);
-            if (ph != nullptr)
-                retVal = pChild->GetPropellantMass(ph);
-        }
+        const PROPELLANT_HANDLE ph = GetCachedPropellantHandle(*pChild, index);  // will be null if child is not an XR consumable tank
+        if (ph != nullptr)
+            retVal = pChild->GetPropellantMass(ph);
     }
     
     return retVal;
 }
 
+// Adds the current quantity and capacity of each of the first propellantCount fuel tanks for this payload to massInOut and maxMassInOut,
+// respectively, if a payload is attached in this slot AND it contains XR fuel.  This retrieves the child vessel only once for all tanks.
+void XRPayloadBaySlot::AddPropellantMasses(double massInOut[], double maxMassInOut[], const int propellantCount) const
+{
+    VESSEL *pChild = GetChild();
+    if (pChild == nullptr)
+        return;     // slot is empty
+
+    for (int i = 0; i < propellantCount; i++)
+    {
+        const PROPELLANT_HANDLE ph = GetCachedPropellantHandle(*pChild, i);  // will be null if child is not an XR consumable tank
+        if (ph != nullptr)
+        {
+            massInOut[i] += pChild->GetPropellantMass(ph);
+            maxMassInOut[i] += pChild->GetPropellantMaxMass(ph);
+        }
+    }
+}
+
 // returns quantity actually adjusted in this slot (takes empty/full into account)
 // delta = amount in kg to add/remove
 // this is 'const' because only the *child vessel* is changed
@@ -438,26 +501,22 @@ double XRPayloadBaySlot::AdjustPropellantMass(const int index, const double delt
     VESSEL *pChild = GetChild();
     if (pChild != nullptr)
     {
-        const PROPELLANT_HANDLE ph = pChild->GetPropellantHandleByIndex(index);
+        const PROPELLANT_HANDLE ph = GetCachedPropellantHandle(*pChild, index);  // will be null if child is not an XR consumable tank
         if (ph != nullptr)
         {
-            const XRPayloadClassData &pcd = XRPayloadClassData::GetXRPayloadClassDataForClassname(pChild->GetClassName());
-            if (pcd.IsXRConsumableTank())
-            {
-                double qty = pChild->GetPropellantMass(ph);
-                const double orgQuantity = qty;
-                const double capacity = pChild->GetPropellantMaxMass(ph); 
-                qty += delta;  // adjust
-
-                // range-check
-                if (qty < 0)
-                    qty = 0;
-                else if (qty > capacity)
-                    qty = capacity;
-                
-                pChild->SetPropellantMass(ph, qty);
-                retVal = qty - orgQuantity;  // delta from original fill level
-            }
+            double qty = pChild->GetPropellantMass(ph);
+            const double orgQuantity = qty;
+            const double capacity = pChild->GetPropellantMaxMass(ph); 
+            qty += delta;  // adjust
+
+            // range-check
+            if (qty < 0)
+                qty = 0;
+            else if (qty > capacity)
+                qty = capacity;
+            
+            pChild->SetPropellantMass(ph, qty);
+            retVal = qty - orgQuantity;  // delta from original fill level
         }
     }
     
@@ -54,7 +54,16 @@ public:
     bool GetRequiredNeighborSlotsForCandidateVessel(const VESSEL &childVessel, vector<const XRPayloadBaySlot *> &vOut) const;  // populates slot ptrs in vOut; returns TRUE if hull edge check OK, or FALSE if vessel would hit the hull edge
     bool CheckSlotSpace(const VESSEL &childVessel) const;  // returns TRUE if there is room to latch the child in this slot; NOTE: may be via explicit-latch
 
+    // slots that a candidate vessel would occupy if it were attached in this slot
+    struct Footprint
+    {
+        SLOTMASK slotMask;  // includes this slot
+        bool clearsHull;    // false if the vessel would hit the hull edge
+    };
+    Footprint GetFootprint(const VESSEL &childVessel) const;
+
     int GetSlotNumber() const                      { return m_slotNumber; }  // 1...n
+    SLOTMASK GetSlotMask() const                   { return XRPayloadBay::GetSlotMask(m_slotNumber); }
     const VECTOR3 &GetLocalCoordinates() const     { return m_localCoordinates; }   // coordinates to the center of the slot
     void SetNeighbor(const NEIGHBOR n, XRPayloadBaySlot *pNeighbor) { m_neighbors[static_cast<int>(n)] = pNeighbor; }
     XRPayloadBaySlot *GetNeighbor(const NEIGHBOR n) const { return m_neighbors[static_cast<int>(n)]; }  // may be null
@@ -82,6 +91,8 @@ public:
     double AdjustSCRAMFuelMass(const double delta) const   { return AdjustPropellantMass(1, delta); }
     double AdjustLOXMass(const double delta) const         { return AdjustPropellantMass(2, delta); }
 
+    void AddPropellantMasses(double massInOut[], double maxMassInOut[], const int propellantCount) const;
+
 protected:
     bool SweepSlots(const VECTOR3 &childCenterOfMass, const VECTOR3 &childDimensions, vector<const XRPayloadBaySlot *> &vOut) const ;
     bool SweepXAxisForSlots(vector<const XRPayloadBaySlot *> &zAxisOriginSlots, const bool addOriginSlotsToVout, const VECTOR3 &childCenterOfMass, const double xAxisLength, vector<const XRPayloadBaySlot *> &vOut) const;
@@ -91,6 +102,22 @@ protected:
     double GetPropellantMass(const int index) const;
     double AdjustPropellantMass(const int index, const double delta) const;  // this is 'const' because only the *child vessel* is changed
 
+    // number of propellant resources cached per child; index 0 = main, 1 = SCRAM, 2 = LOX
+    static const int CACHED_PROPELLANT_COUNT = 3;
+
+    // class data and propellant handles for the child currently attached in this slot, so the per-frame propellant
+    // methods do not need to look up the child's XRPayloadClassData by classname each time
+    struct ChildPropellantCache
+    {
+        OBJHANDLE hChild;                   // nullptr = cache empty
+        const VESSEL *pChild;               // checked along with hChild since Orbiter may reuse handles for new vessels
+        bool isXRConsumableTank;
+        PROPELLANT_HANDLE propellantHandles[CACHED_PROPELLANT_COUNT];  // may contain nulls
+    };
+
+    PROPELLANT_HANDLE GetCachedPropellantHandle(VESSEL &child, const int index) const;
+    void InvalidateChildPropellantCache() const { m_childCache.hChild = nullptr; m_childCache.pChild = nullptr; }
+
     XRPayloadBay &m_parentBay;
     ATTACHMENTHANDLE m_hAttachmentHandle;   // parent vessel's attachment handle
     const int m_slotNumber;  // 1...n
@@ -103,4 +130,10 @@ protected:
     // If true, this slot is available for explicit attach/detach operations by the pilot; i.e., it is "enabled."
     // If false, this slot is occupied by a payload that was explicitly attached in a *neighboring* slot; i.e., it is "disabled" until the neighboring payload is detached.
     bool m_isEnabled; 
+
+    mutable ChildPropellantCache m_childCache;  // refreshed on demand whenever a different child is detected in this slot
+
+    // footprints computed so far for payload vessel classes in this slot; the bay geometry never changes, so these never go stale
+    // key = the class's XRPayloadClassData, which is not freed until the module exits
+    mutable unordered_map<const XRPayloadClassData *, Footprint> m_footprintCache;
 }; 
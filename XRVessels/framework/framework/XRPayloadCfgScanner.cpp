@@ -0,0 +1,525 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+// ==============================================================
+// XRPayloadCfgScanner.cpp
+// Scans all vessel .cfg files under Config\Vessels for XRPayload data.
+// Files are parsed in parallel on worker threads, and the results are saved
+// to an on-disk index so that unchanged files are not parsed again on the
+// next launch.
+// ==============================================================
+
+#include "XRPayloadCfgScanner.h"
+#include "FileList.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+// bump this whenever the index file format or the parsing rules change so that stale indexes are discarded
+#define XRPAYLOAD_INDEX_VERSION     2
+#define XRPAYLOAD_INDEX_HEADER      "XRPayloadIndex"
+#define XRPAYLOAD_INDEX_FIELD_COUNT 13
+
+// never spin up a worker thread for fewer than this many files
+const int MIN_FILES_PER_PARSE_THREAD = 32;
+const int MAX_PARSE_THREADS = 8;
+
+//=========================================================================
+// Lightweight .cfg key extractor
+//
+// WARNING: the oapiReadItem_* methods are not thread-safe, so we parse the files ourselves here.  The rules match how the
+// Orbiter core reads items: keys are case-insensitive, the first matching line wins, anything after a ';' is a comment,
+// and string values are the remainder of the line with leading and trailing whitespace removed.
+//=========================================================================
+
+// a single "key = value" line from a .cfg file
+struct CfgLine
+{
+    string_view key;
+    string_view value;
+};
+
+static string_view Trim(string_view s)
+{
+    while (!s.empty() && ((s.front() == ' ') || (s.front() == '\t')))
+        s.remove_prefix(1);
+    while (!s.empty() && ((s.back() == ' ') || (s.back() == '\t') || (s.back() == '\r')))
+        s.remove_suffix(1);
+    return s;
+}
+
+// Returns the value of the first line with the specified key (case-insensitive), or nullptr if key not found
+static const string_view *FindValue(const vector<CfgLine> &lines, const string_view key)
+{
+    for (const CfgLine &line : lines)
+    {
+        if ((line.key.size() == key.size()) && (_strnicmp(line.key.data(), key.data(), key.size()) == 0))
+            return &line.value;
+    }
+    return nullptr;
+}
+
+static void ReadBool(const vector<CfgLine> &lines, const char *pKey, bool &valueOut)
+{
+    const string_view *pValue = FindValue(lines, pKey);
+    if (pValue == nullptr)
+        return;
+
+    if ((pValue->size() >= 4) && (_strnicmp(pValue->data(), "true", 4) == 0))
+        valueOut = true;
+    else if ((pValue->size() >= 5) && (_strnicmp(pValue->data(), "false", 5) == 0))
+        valueOut = false;
+    // else invalid value, so leave the default in place
+}
+
+static void ReadDouble(const vector<CfgLine> &lines, const char *pKey, double &valueOut)
+{
+    const string_view *pValue = FindValue(lines, pKey);
+    if (pValue == nullptr)
+        return;
+
+    const string value(*pValue);    // must be zero-terminated for sscanf
+    double d;
+    if (sscanf(value.c_str(), "%lf", &d) == 1)
+        valueOut = d;
+}
+
+static void ReadVector(const vector<CfgLine> &lines, const char *pKey, VECTOR3 &valueOut)
+{
+    const string_view *pValue = FindValue(lines, pKey);
+    if (pValue == nullptr)
+        return;
+
+    const string value(*pValue);    // must be zero-terminated for sscanf
+    VECTOR3 v;
+    if (sscanf(value.c_str(), "%lf%lf%lf", &v.x, &v.y, &v.z) == 3)
+        valueOut = v;
+}
+
+static bool ReadString(const vector<CfgLine> &lines, const string_view key, string &valueOut)
+{
+    const string_view *pValue = FindValue(lines, key);
+    if (pValue == nullptr)
+        return false;
+
+    valueOut = *pValue;
+    return true;
+}
+
+// Splits s on the supplied separator, skipping empty tokens
+static vector<string_view> SplitTokens(string_view s, const char separator)
+{
+    vector<string_view> retVal;
+    while (!s.empty())
+    {
+        const size_t end = s.find(separator);
+        const string_view token = s.substr(0, end);
+        if (!token.empty())
+            retVal.push_back(token);
+        if (end == string_view::npos)
+            break;
+        s.remove_prefix(end + 1);
+    }
+    return retVal;
+}
+
+// Constructor: sets the defaults used for any settings not present in a .cfg file
+XRPayloadCfgData::XRPayloadCfgData() :
+    isXRPayloadEnabled(false), isXRConsumableTank(false), description("Unknown"),
+    dimensions(_V(1, 1, 1)), mass(1.0),    // UNKNOWN; should never happen!
+    primarySlotCenterOfMassOffset(_V(0, 0, 0)),  // default to "mass centered in primary slot"
+    groundDeploymentAdjustment(_V(0, 0, 0))      // default to "no adjustment"
+{
+}
+
+// Parse the XRPayload settings out of the specified .cfg file.  This method is thread-safe.
+// pFilespec = path relative to the Orbiter root; e.g., "Config\Vessels\XRParts.cfg"
+// Returns true on success, or false if the file could not be read (dataOut is not changed in that case)
+bool XRPayloadCfgScanner::ParseCfgFile(const char *pFilespec, XRPayloadCfgData &dataOut)
+{
+    FILE *pFile = fopen(pFilespec, "rb");
+    if (pFile == nullptr)
+        return false;
+
+    // read the entire file in one shot
+    string contents;
+    fseek(pFile, 0, SEEK_END);
+    const long fileSize = ftell(pFile);
+    fseek(pFile, 0, SEEK_SET);
+    if (fileSize > 0)
+    {
+        contents.resize(fileSize);
+        contents.resize(fread(&contents[0], 1, fileSize, pFile));
+    }
+    fclose(pFile);
+
+    // break the file into "key = value" lines
+    vector<CfgLine> lines;
+    string_view remaining(contents);
+    while (!remaining.empty())
+    {
+        size_t eol = remaining.find('\n');
+        string_view line = remaining.substr(0, eol);
+        remaining.remove_prefix((eol == string_view::npos) ? remaining.size() : eol + 1);
+
+        const size_t commentStart = line.find(';');
+        if (commentStart != string_view::npos)
+            line = line.substr(0, commentStart);
+
+        const size_t equalsIndex = line.find('=');
+        if (equalsIndex == string_view::npos)
+            continue;   // not a "key = value" line
+
+        CfgLine cfgLine = { Trim(line.substr(0, equalsIndex)), Trim(line.substr(equalsIndex + 1)) };
+        if (!cfgLine.key.empty())
+            lines.push_back(cfgLine);
+    }
+
+    ReadBool  (lines, "XRPayloadEnabled", dataOut.isXRPayloadEnabled);
+    ReadString(lines, "Description", dataOut.description);
+    ReadVector(lines, "Dimensions", dataOut.dimensions);
+    ReadDouble(lines, "Mass", dataOut.mass);
+    ReadBool  (lines, "XRConsumableTank", dataOut.isXRConsumableTank);
+    ReadVector(lines, "PrimarySlotCenterOfMassOffset", dataOut.primarySlotCenterOfMassOffset);
+    ReadString(lines, "ThumbnailPath", dataOut.thumbnailPath);
+    ReadVector(lines, "GroundDeploymentAdjustment", dataOut.groundDeploymentAdjustment);
+
+    // explicit attachment points: a space-delimited list of vessel classnames, each of which has its own "<classname>_ExplicitAttachmentSlots" line
+    string vesselsWithExplicitAttachmentSlotsDefined;
+    if (ReadString(lines, "VesselsWithExplicitAttachmentSlotsDefined", vesselsWithExplicitAttachmentSlotsDefined))
+    {
+        for (const string_view vesselClassname : SplitTokens(vesselsWithExplicitAttachmentSlotsDefined, ' '))
+        {
+            string prefName(vesselClassname);
+            prefName += "_ExplicitAttachmentSlots";    // e.g., "XR5Vanguard_ExplicitAttachmentSlots"
+
+            string explicitAttachmentSlotsStr;
+            if (ReadString(lines, prefName, explicitAttachmentSlotsStr))
+            {
+                // slot data defined; parse out the space-delimited slot integer values
+                vector<int> slotNumbers;
+                for (const string_view slotInt : SplitTokens(explicitAttachmentSlotsStr, ' '))
+                {
+                    const int slotNumber = atoi(string(slotInt).c_str());
+                    if (slotNumber > 0)
+                        slotNumbers.push_back(slotNumber);    // slot number is valid
+                }
+                dataOut.explicitAttachmentSlots.push_back(make_pair(string(vesselClassname), slotNumbers));
+            }
+        }
+    }
+
+    return true;
+}
+
+//=========================================================================
+
+// Constructor
+// pVesselsRootPath = root of the tree to scan, relative to the Orbiter root; e.g., "Config\Vessels"
+// pIndexFilespec = path of our on-disk index file, relative to the Orbiter root
+XRPayloadCfgScanner::XRPayloadCfgScanner(const char *pVesselsRootPath, const char *pIndexFilespec) :
+    m_vesselsRootPath(pVesselsRootPath), m_indexFilespec(pIndexFilespec),
+    m_parsedCount(0), m_indexHitCount(0), m_threadCount(0), m_elapsedMillis(0)
+{
+}
+
+// Scan the tree for .cfg files and populate GetEntries() with the XRPayload data for each one.
+// Files whose path, timestamp, and size match our on-disk index are not parsed again; this includes files that failed to parse.
+void XRPayloadCfgScanner::Scan()
+{
+    LARGE_INTEGER startTicks, endTicks, freq;
+    QueryPerformanceCounter(&startTicks);
+
+    EnumerateFiles();
+
+    HASHMAP_STR_ENTRY index;
+    string indexContents;
+    LoadIndex(index, indexContents);    // if this fails the index is simply empty, so every file is parsed
+
+    // pull each unchanged file's data from the index and queue the rest for parsing
+    vector<int> entriesToParse;
+    for (int i = 0; i < static_cast<int>(m_entries.size()); i++)
+    {
+        Entry &entry = m_entries[i];
+        auto it = index.find(entry.configFilespec);
+        if ((it != index.end()) && (it->second.lastWriteTime == entry.lastWriteTime) && (it->second.fileSize == entry.fileSize))
+        {
+            entry.data = it->second.data;
+            entry.isParsed = it->second.isParsed;   // an unchanged file that failed to parse would only fail again
+            m_indexHitCount++;
+        }
+        else
+            entriesToParse.push_back(i);
+    }
+
+    ParseFilesInParallel(entriesToParse);
+    m_parsedCount = static_cast<int>(entriesToParse.size());
+
+    // only rewrite the index if its contents changed (new, changed, or deleted files)
+    const string newIndexContents = BuildIndex();
+    if (newIndexContents != indexContents)
+        SaveIndex(newIndexContents);
+
+    QueryPerformanceCounter(&endTicks);
+    QueryPerformanceFrequency(&freq);
+    m_elapsedMillis = static_cast<double>(endTicks.QuadPart - startTicks.QuadPart) * 1000.0 / static_cast<double>(freq.QuadPart);
+}
+
+// Walk the tree and add an entry for each non-empty .cfg file; data is not parsed here
+void XRPayloadCfgScanner::EnumerateFiles()
+{
+    // Custom FileList scanner to collect .cfg files here
+    class CfgFileList : public FileList
+    {
+    public:
+        CfgFileList(const char *pRootPath, vector<Entry> &entries) :
+            FileList(pRootPath, true, ".cfg"), m_entries(entries), m_rootPathLength(strlen(pRootPath))
+        {
+        }
+
+    protected:
+        // Callback invoked for non-empty .cfg files.
+        virtual void clbkProcessFile(const char *pConfigFilespec, const WIN32_FIND_DATA &fd) override
+        {
+            // The vessel's classname is everything between the leading "Config\Vessels\" prefix and the trailing ".cfg";
+            // e.g., "UCGO\foo.cfg" -> "UCGO\foo"
+            const string_view filespec(pConfigFilespec);
+            const size_t prefixLength = m_rootPathLength + 1;   // include the trailing "\"
+            const size_t classnameLength = filespec.size() - prefixLength - 4;  // don't copy trailing ".cfg" either (4 bytes)
+
+            Entry entry;
+            entry.configFilespec = pConfigFilespec;
+            entry.classname = filespec.substr(prefixLength, classnameLength);
+            entry.lastWriteTime = (static_cast<unsigned __int64>(fd.ftLastWriteTime.dwHighDateTime) << 32) | fd.ftLastWriteTime.dwLowDateTime;
+            entry.fileSize = (static_cast<unsigned __int64>(fd.nFileSizeHigh) << 32) | fd.nFileSizeLow;
+            m_entries.push_back(entry);
+        }
+
+        vector<Entry> &m_entries;
+        const size_t m_rootPathLength;
+    };
+
+    m_entries.clear();
+    CfgFileList fileList(m_vesselsRootPath.c_str(), m_entries);
+    fileList.Scan();    // invokes our clbkProcessFile method above for each .cfg file found
+}
+
+// Parse the specified entries on a pool of worker threads; the calling thread works on the list as well
+void XRPayloadCfgScanner::ParseFilesInParallel(const vector<int> &entryIndexes)
+{
+    const int fileCount = static_cast<int>(entryIndexes.size());
+    const int hardwareThreads = max(1, static_cast<int>(thread::hardware_concurrency()));
+    m_threadCount = min(min(hardwareThreads, MAX_PARSE_THREADS), (fileCount / MIN_FILES_PER_PARSE_THREAD) + 1);
+
+    // each worker claims the next unparsed file until none are left; entries are only ever touched by one worker
+    atomic<int> nextIndex(0);
+    auto worker = [&]()
+    {
+        for (int i = nextIndex++; i < fileCount; i = nextIndex++)
+        {
+            Entry &entry = m_entries[entryIndexes[i]];
+            entry.isParsed = ParseCfgFile(entry.configFilespec.c_str(), entry.data);   // if this fails the data stays at default values
+        }
+    };
+
+    vector<thread> workerThreads;
+    for (int i = 1; i < m_threadCount; i++)
+        workerThreads.emplace_back(worker);
+
+    worker();
+    for (thread &t : workerThreads)
+        t.join();
+}
+
+// Replaces any tab or newline characters so a string may be saved as a single index field
+static string IndexField(const string &s)
+{
+    string retVal(s);
+    replace_if(retVal.begin(), retVal.end(), [](const char c) { return ((c == '\t') || (c == '\r') || (c == '\n')); }, ' ');
+    return retVal;
+}
+
+// Load our on-disk index.
+// contentsOut = OUT: the raw index file, or empty if it does not exist; this is set even if the index is invalid
+// Returns true on success, or false if the index does not exist, is from a different version, or is corrupt
+bool XRPayloadCfgScanner::LoadIndex(HASHMAP_STR_ENTRY &indexOut, string &contentsOut) const
+{
+    contentsOut.clear();
+
+    FILE *pFile = fopen(m_indexFilespec.c_str(), "rb");
+    if (pFile == nullptr)
+        return false;   // no index yet
+
+    fseek(pFile, 0, SEEK_END);
+    const long fileSize = ftell(pFile);
+    fseek(pFile, 0, SEEK_SET);
+    if (fileSize > 0)
+    {
+        contentsOut.resize(fileSize);
+        contentsOut.resize(fread(&contentsOut[0], 1, fileSize, pFile));
+    }
+    fclose(pFile);
+
+    const vector<string_view> lines = SplitTokens(contentsOut, '\n');
+    char header[64];
+    sprintf(header, "%s\t%d", XRPAYLOAD_INDEX_HEADER, XRPAYLOAD_INDEX_VERSION);
+    if (lines.empty() || (lines[0] != header))
+        return false;   // different version or not an index file
+
+    for (size_t lineIndex = 1; lineIndex < lines.size(); lineIndex++)
+    {
+        // split on tabs, keeping empty fields
+        vector<string> fields;
+        string_view line = lines[lineIndex];
+        for (;;)
+        {
+            const size_t tab = line.find('\t');
+            fields.push_back(string(line.substr(0, tab)));
+            if (tab == string_view::npos)
+                break;
+            line.remove_prefix(tab + 1);
+        }
+
+        if (fields.size() != XRPAYLOAD_INDEX_FIELD_COUNT)
+        {
+            indexOut.clear();
+            return false;   // corrupt
+        }
+
+        Entry entry;
+        XRPayloadCfgData &data = entry.data;
+        int isXRPayloadEnabled, isXRConsumableTank, isParsed;
+        const bool bValid =
+            (sscanf(fields[12].c_str(), "%d", &isParsed) == 1) &&
+            (sscanf(fields[1].c_str(), "%I64u", &entry.lastWriteTime) == 1) &&
+            (sscanf(fields[2].c_str(), "%I64u", &entry.fileSize) == 1) &&
+            (sscanf(fields[3].c_str(), "%d", &isXRPayloadEnabled) == 1) &&
+            (sscanf(fields[4].c_str(), "%d", &isXRConsumableTank) == 1) &&
+            (sscanf(fields[5].c_str(), "%lf", &data.mass) == 1) &&
+            (sscanf(fields[6].c_str(), "%lf%lf%lf", &data.dimensions.x, &data.dimensions.y, &data.dimensions.z) == 3) &&
+            (sscanf(fields[7].c_str(), "%lf%lf%lf", &data.primarySlotCenterOfMassOffset.x, &data.primarySlotCenterOfMassOffset.y, &data.primarySlotCenterOfMassOffset.z) == 3) &&
+            (sscanf(fields[8].c_str(), "%lf%lf%lf", &data.groundDeploymentAdjustment.x, &data.groundDeploymentAdjustment.y, &data.groundDeploymentAdjustment.z) == 3);
+        if (!bValid)
+        {
+            indexOut.clear();
+            return false;   // corrupt
+        }
+
+        entry.configFilespec = fields[0];
+        entry.isParsed = (isParsed != 0);
+        data.isXRPayloadEnabled = (isXRPayloadEnabled != 0);
+        data.isXRConsumableTank = (isXRConsumableTank != 0);
+        data.thumbnailPath = fields[9];
+        data.description = fields[10];
+
+        // explicit attachment slots: "classname=1 2 3|classname2=4 5"
+        for (const string_view slotGroup : SplitTokens(fields[11], '|'))
+        {
+            const size_t equalsIndex = slotGroup.rfind('=');
+            if (equalsIndex == string_view::npos)
+                continue;
+
+            vector<int> slotNumbers;
+            for (const string_view slotInt : SplitTokens(slotGroup.substr(equalsIndex + 1), ' '))
+                slotNumbers.push_back(atoi(string(slotInt).c_str()));
+            data.explicitAttachmentSlots.push_back(make_pair(string(slotGroup.substr(0, equalsIndex)), slotNumbers));
+        }
+
+        indexOut[entry.configFilespec] = entry;
+    }
+
+    return true;
+}
+
+// Format all current entries as an index file.  Files that failed to parse are included as well, with their default
+// data, so that they are not parsed again until they change.
+string XRPayloadCfgScanner::BuildIndex() const
+{
+    char line[128];
+    sprintf(line, "%s\t%d\n", XRPAYLOAD_INDEX_HEADER, XRPAYLOAD_INDEX_VERSION);
+    string retVal(line);
+
+    for (const Entry &entry : m_entries)
+    {
+        const XRPayloadCfgData &data = entry.data;
+
+        string slots;
+        for (const auto &slotGroup : data.explicitAttachmentSlots)
+        {
+            if (!slots.empty())
+                slots += '|';
+            slots += IndexField(slotGroup.first);
+            slots += '=';
+            for (size_t i = 0; i < slotGroup.second.size(); i++)
+            {
+                if (i > 0)
+                    slots += ' ';
+                slots += to_string(slotGroup.second[i]);
+            }
+        }
+
+        // Note: %.17g round-trips doubles exactly
+        char numbers[512];
+        sprintf(numbers, "\t%I64u\t%I64u\t%d\t%d\t%.17g\t%.17g %.17g %.17g\t%.17g %.17g %.17g\t%.17g %.17g %.17g\t",
+            entry.lastWriteTime, entry.fileSize,
+            (data.isXRPayloadEnabled ? 1 : 0), (data.isXRConsumableTank ? 1 : 0), data.mass,
+            data.dimensions.x, data.dimensions.y, data.dimensions.z,
+            data.primarySlotCenterOfMassOffset.x, data.primarySlotCenterOfMassOffset.y, data.primarySlotCenterOfMassOffset.z,
+            data.groundDeploymentAdjustment.x, data.groundDeploymentAdjustment.y, data.groundDeploymentAdjustment.z);
+
+        retVal += IndexField(entry.configFilespec);
+        retVal += numbers;
+        retVal += IndexField(data.thumbnailPath);
+        retVal += '\t';
+        retVal += IndexField(data.description);
+        retVal += '\t';
+        retVal += slots;
+        retVal += (entry.isParsed ? "\t1\n" : "\t0\n");
+    }
+
+    return retVal;
+}
+
+// Save the supplied index contents to our on-disk index.  The index is written to a temporary file first and then moved into place
+// so that a crash mid-write cannot leave a truncated index behind.
+// Returns true on success, false on error
+bool XRPayloadCfgScanner::SaveIndex(const string &contents) const
+{
+    const string tempFilespec = m_indexFilespec + ".tmp";
+    FILE *pFile = fopen(tempFilespec.c_str(), "wb");
+    if (pFile == nullptr)
+        return false;
+
+    fwrite(contents.data(), 1, contents.size(), pFile);
+
+    const bool bWriteOK = (ferror(pFile) == 0);
+    fclose(pFile);
+    if (!bWriteOK)
+    {
+        DeleteFile(tempFilespec.c_str());
+        return false;
+    }
+
+    return (MoveFileEx(tempFilespec.c_str(), m_indexFilespec.c_str(), MOVEFILE_REPLACE_EXISTING) != 0);
+}
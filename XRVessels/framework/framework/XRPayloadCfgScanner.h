@@ -0,0 +1,102 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+// ==============================================================
+// XRPayloadCfgScanner.h
+// Scans all vessel .cfg files under Config\Vessels for XRPayload data.
+// Files are parsed in parallel on worker threads, and the results are saved
+// to an on-disk index so that unchanged files are not parsed again on the
+// next launch.
+// ==============================================================
+
+#pragma once
+
+#include "windows.h"
+#include "OrbiterAPI.h"
+#include "stringhasher.h"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+using namespace std;
+
+// XRPayload settings parsed from a single vessel .cfg file; any setting not present in the file keeps its default value
+struct XRPayloadCfgData
+{
+    XRPayloadCfgData();
+
+    bool isXRPayloadEnabled;
+    bool isXRConsumableTank;
+    string description;
+    VECTOR3 dimensions;
+    double mass;
+    VECTOR3 primarySlotCenterOfMassOffset;
+    string thumbnailPath;       // Config-relative; empty = use the default thumbnail
+    VECTOR3 groundDeploymentAdjustment;
+    vector<pair<string, vector<int>>> explicitAttachmentSlots;   // first = parent vessel classname, second = slot numbers
+};
+
+class XRPayloadCfgScanner
+{
+public:
+    // a single vessel .cfg file found by the scan
+    struct Entry
+    {
+        Entry() : lastWriteTime(0), fileSize(0), isParsed(false) { }
+
+        string configFilespec;          // path relative to the Orbiter root; e.g., "Config\Vessels\UCGO\foo.cfg"
+        string classname;               // e.g., "UCGO\foo"
+        unsigned __int64 lastWriteTime; // from WIN32_FIND_DATA
+        unsigned __int64 fileSize;      // from WIN32_FIND_DATA
+        bool isParsed;                  // true if the file parsed successfully, now or when it was indexed; false = data is defaults only
+        XRPayloadCfgData data;
+    };
+
+    XRPayloadCfgScanner(const char *pVesselsRootPath, const char *pIndexFilespec);
+
+    void Scan();
+    static bool ParseCfgFile(const char *pFilespec, XRPayloadCfgData &dataOut);
+
+    const vector<Entry> &GetEntries() const { return m_entries; }
+    int GetParsedCount() const      { return m_parsedCount; }   // files parsed this time (i.e., not in the index or changed since)
+    int GetIndexHitCount() const    { return m_indexHitCount; } // files whose data came from the index
+    int GetThreadCount() const      { return m_threadCount; }   // worker threads used to parse files
+    double GetElapsedMillis() const { return m_elapsedMillis; } // total wall-clock time for the scan
+
+protected:
+    // index records loaded from disk: key = configFilespec
+    typedef unordered_map<string, Entry, stringhasher, stringhasher> HASHMAP_STR_ENTRY;
+
+    void EnumerateFiles();
+    void ParseFilesInParallel(const vector<int> &entryIndexes);
+    bool LoadIndex(HASHMAP_STR_ENTRY &indexOut, string &contentsOut) const;
+    string BuildIndex() const;
+    bool SaveIndex(const string &contents) const;
+
+    string m_vesselsRootPath;   // e.g., "Config\Vessels"
+    string m_indexFilespec;     // e.g., "XRPayloadIndex.dat"
+    vector<Entry> m_entries;
+    int m_parsedCount;
+    int m_indexHitCount;
+    int m_threadCount;
+    double m_elapsedMillis;
+};
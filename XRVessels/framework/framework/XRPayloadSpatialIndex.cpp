@@ -0,0 +1,163 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+// ==============================================================
+// XRPayloadSpatialIndex.cpp
+// k-d tree of the global positions of all XRPayload-enabled vessels in
+// the simulation.
+// ==============================================================
+
+#include "XRPayloadSpatialIndex.h"
+#include "XRPayload.h"
+
+#include <algorithm>
+
+// Returns the index shared by all XR vessels in this module
+XRPayloadSpatialIndex &XRPayloadSpatialIndex::GetInstance()
+{
+    static XRPayloadSpatialIndex s_instance;
+    return s_instance;
+}
+
+// Constructor
+XRPayloadSpatialIndex::XRPayloadSpatialIndex() :
+    m_builtSimt(-1), m_cachedVesselCount(0)
+{
+}
+
+// Find all XRPayload-enabled vessels within range meters of globalPos.  The index is rebuilt the first time this is 
+// invoked in a given frame, so all queries in the same frame share the same build.
+//
+// itemsOut = OUT: cleared and then populated with the vessels in range, in Orbiter's vessel order; the caller's own vessel 
+//            will be included if it is XRPayload-enabled.  These pointers are valid until the next frame.
+void XRPayloadSpatialIndex::FindVesselsInRange(const VECTOR3 &globalPos, const double range, vector<const Item *> &itemsOut)
+{
+    // We cannot use the caller's VESSEL3_EXT::GetAbsoluteSimTime() to detect a new frame here: it counts from when each vessel 
+    // was created, so vessels created at different times never agree.  Orbiter's own simt is the same for every vessel within a 
+    // frame and changes every frame while the simulation is running, so it is safe for this equality test even though XR code 
+    // must not use it for time deltas (see VESSEL3_EXT::clbkPreStep).  simt does not change while paused, so we also rebuild
+    // if vessels were created or deleted since.
+    const double simt = oapiGetSimTime();
+    if ((simt != m_builtSimt) || (oapiGetVesselCount() != m_cachedVesselCount))
+    {
+        Rebuild();
+        m_builtSimt = simt;
+    }
+
+    itemsOut.clear();
+    FindInSubtree(0, static_cast<int>(m_items.size()), 0, globalPos, range, itemsOut);
+
+    // keep the same order as Orbiter's vessel list so that callers' lists don't shuffle as vessels move
+    sort(itemsOut.begin(), itemsOut.end(), [](const Item *a, const Item *b) { return a->vesselIndex < b->vesselIndex; });
+}
+
+// Rebuild the tree from the current positions of all XRPayload-enabled vessels
+void XRPayloadSpatialIndex::Rebuild()
+{
+    const DWORD vesselCount = oapiGetVesselCount();
+
+    // Entries are validated by class name, so this is only to drop the entries of deleted vessels.
+    if (vesselCount != m_cachedVesselCount)
+    {
+        m_isXRPayloadVesselCache.clear();
+        m_cachedVesselCount = vesselCount;
+    }
+
+    m_items.clear();
+    for (DWORD i = 0; i < vesselCount; i++)
+    {
+        const OBJHANDLE hVessel = oapiGetVesselByIndex(i);
+        if (!IsXRPayloadVessel(hVessel))
+            continue;
+
+        Item item;
+        oapiGetGlobalPos(hVessel, &item.globalPos);
+        item.hVessel = hVessel;
+        item.vesselIndex = static_cast<int>(i);
+        m_items.push_back(item);
+    }
+
+    BuildSubtree(0, static_cast<int>(m_items.size()), 0);
+}
+
+// Arrange m_items[begin, end) so that its median (by the supplied axis) is at the midpoint, with smaller values before it
+// and larger values after it, and then do the same for each half on the next axis.
+void XRPayloadSpatialIndex::BuildSubtree(const int begin, const int end, const int axis)
+{
+    if ((end - begin) <= 1)
+        return;
+
+    const int mid = (begin + end) / 2;
+    nth_element(m_items.begin() + begin, m_items.begin() + mid, m_items.begin() + end,
+        [axis](const Item &a, const Item &b) { return a.globalPos.data[axis] < b.globalPos.data[axis]; });
+
+    const int nextAxis = (axis + 1) % 3;
+    BuildSubtree(begin, mid, nextAxis);
+    BuildSubtree(mid + 1, end, nextAxis);
+}
+
+// Add all items in m_items[begin, end) within range of globalPos to itemsOut
+void XRPayloadSpatialIndex::FindInSubtree(const int begin, const int end, const int axis, const VECTOR3 &globalPos, const double range, vector<const Item *> &itemsOut) const
+{
+    if (begin >= end)
+        return;
+
+    const int mid = (begin + end) / 2;
+    const Item &item = m_items[mid];
+    if (dist(item.globalPos, globalPos) <= range)
+        itemsOut.push_back(&item);
+
+    // search the half containing globalPos first, and the other half only if the sphere crosses the splitting plane
+    const double delta = globalPos.data[axis] - item.globalPos.data[axis];
+    const int nextAxis = (axis + 1) % 3;
+    if (delta < 0)
+    {
+        FindInSubtree(begin, mid, nextAxis, globalPos, range, itemsOut);
+        if (-delta <= range)
+            FindInSubtree(mid + 1, end, nextAxis, globalPos, range, itemsOut);
+    }
+    else
+    {
+        FindInSubtree(mid + 1, end, nextAxis, globalPos, range, itemsOut);
+        if (delta <= range)
+            FindInSubtree(begin, mid, nextAxis, globalPos, range, itemsOut);
+    }
+}
+
+// Returns true if the supplied vessel's class is XRPayload-enabled
+bool XRPayloadSpatialIndex::IsXRPayloadVessel(const OBJHANDLE hVessel)
+{
+    // Orbiter may reuse a deleted vessel's handle for a new vessel in the same frame, even with no change in the vessel count,
+    // so a cached entry is only valid if the class name still matches.
+    const VESSEL *pVessel = oapiGetVesselInterface(hVessel);
+    const char *pClassname = pVessel->GetClassName();    // may be null, e.g., for Mir
+    const char *pCacheClassname = ((pClassname != nullptr) ? pClassname : "");
+
+    const auto result = m_isXRPayloadVesselCache.try_emplace(hVessel);
+    VesselClassInfo &info = result.first->second;
+    if (result.second || (info.classname != pCacheClassname))   // new entry, or a different vessel now has this handle?
+    {
+        info.classname = pCacheClassname;
+        info.isXRPayload = XRPayloadClassData::GetXRPayloadClassDataForClassname(pClassname).IsXRPayloadEnabled();
+    }
+
+    return info.isXRPayload;
+}
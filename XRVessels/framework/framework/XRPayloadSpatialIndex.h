@@ -0,0 +1,73 @@
+/**
+  XR Vessel add-ons for OpenOrbiter Space Flight Simulator
+  Copyright (C) 2006-2025 Douglas Beachy
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Email: mailto:doug.beachy@outlook.com
+  Web: https://www.alteaaerospace.com
+**/
+
+// ==============================================================
+// XRPayloadSpatialIndex.h
+// k-d tree of the global positions of all XRPayload-enabled vessels in
+// the simulation, rebuilt at most once per frame and shared by all XR
+// vessels in this module.  This lets each vessel find the payload
+// vessels within a given range without walking every vessel in the sim.
+// ==============================================================
+
+#pragma once
+
+#include "OrbiterAPI.h"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+using namespace std;
+
+class XRPayloadSpatialIndex
+{
+public:
+    // a single XRPayload-enabled vessel in the index
+    struct Item
+    {
+        VECTOR3 globalPos;      // at the time the index was built
+        OBJHANDLE hVessel;
+        int vesselIndex;        // index passed to oapiGetVesselByIndex
+    };
+
+    static XRPayloadSpatialIndex &GetInstance();
+
+    void FindVesselsInRange(const VECTOR3 &globalPos, const double range, vector<const Item *> &itemsOut);
+
+protected:
+    XRPayloadSpatialIndex();
+
+    void Rebuild();
+    void BuildSubtree(const int begin, const int end, const int axis);
+    void FindInSubtree(const int begin, const int end, const int axis, const VECTOR3 &globalPos, const double range, vector<const Item *> &itemsOut) const;
+    bool IsXRPayloadVessel(const OBJHANDLE hVessel);
+
+    vector<Item> m_items;       // implicit k-d tree: the median of each subrange is the node, split on axis x, y, z, x, ...
+    double m_builtSimt;         // Orbiter simt (shared by all vessels) at which m_items was last built; -1 = never
+    // whether a vessel's class is XRPayload-enabled; the class name is stored because Orbiter may reuse a deleted vessel's handle
+    struct VesselClassInfo
+    {
+        string classname;
+        bool isXRPayload;
+    };
+    unordered_map<OBJHANDLE, VesselClassInfo> m_isXRPayloadVesselCache;    // key = vessel handle
+    DWORD m_cachedVesselCount;  // vessel count when m_items was last built
+};
@@ -26,103 +26,57 @@
 
 #pragma once
 
+#include "RollingWindow.h"
+
 // Utility class that is used to average values over a number of renders;
 // typically only useful when updated each frame.
 template<class T>
-class Averager 
+class Averager : public RollingWindow<T>
 {
-protected:
-    const int m_bufferSize; // max # of samples in sample window
-    int m_sampleCount;      // current # of samples in window: 0 <= n <= m_windowSize
-    int m_sampleIndex;      // index to where the NEXT sample will be added to the sample buffer
-    T *m_pSampleBuffer;     // array of values to be averaged
-
 public:
     // Constructor
     // bufferSize = # of samples in the average buffer
     // NOTE: if bufferSize == 1, average will always be the last value set via AddSample
     Averager(const int bufferSize) :
-        m_bufferSize(bufferSize), m_sampleCount(0), m_sampleIndex(0)
-    {
-        m_pSampleBuffer = new T[bufferSize];
-    }
-
-    // Destructor
-    ~Averager()
+        RollingWindow<T>(bufferSize)
     {
-        delete[] m_pSampleBuffer;
-    }
-
-    // Add a sample to the buffer, overwriting the oldest value if necessary
-    void AddSample(T value)
-    {
-        m_pSampleBuffer[m_sampleIndex] = value;
-
-        // increment the sample index
-        if (m_sampleIndex == m_bufferSize-1)
-            m_sampleIndex = 0;  // wrap around
-        else
-            m_sampleIndex++;
-
-        // update the sample count
-        if (m_sampleCount < m_bufferSize)
-            m_sampleCount++;
     }
 
     // Returns the MEAN of all samples in the buffer
     // Throws fatal error if no samples added yet.
-    T Averager<T>::GetMean()
+    T GetMean() const
     {
-        if (m_sampleCount == 0)
+        if (this->GetSampleCount() == 0)
             throw "Averager.GetMean: no samples in buffer!";
 
-        // add up all the samples in the buffer
-        T sum = 0;
-        for (int i=0; i < m_sampleCount; i++)
-            sum += m_pSampleBuffer[i];
-
-        // now divide it by the total number of samples
-        T retVal = sum / (T)m_sampleCount;
-
-        return retVal;
+        return RollingWindow<T>::GetMean();
     }
 
     // Returns the MEDIAN of all samples in the buffer
     // Throws fatal error if no samples added yet.
-    // WARNING: this is relatively expensive with a large sample count.
-    T Averager<T>::GetMedian()
+    T GetMedian() const
     {
-        if (m_sampleCount == 0)
-            throw "Averager.GetAverage: no samples in buffer!";
-
-        // find the MEDIAN value via a bubble sort
-        bool cont = true;
-        while (cont)
-        {
-            cont = false;   // reset
-            for (int i=0; i < m_sampleCount-1; i++)
-            {
-                if (m_pSampleBuffer[i] > m_pSampleBuffer[i+1])  
-                {
-                    // they're in the wrong order; swap them
-                    T temp = m_pSampleBuffer[i];
-                    m_pSampleBuffer[i] = m_pSampleBuffer[i+1];
-                    m_pSampleBuffer[i+1] = temp;
-                    cont = true;    // must loop again
-                }
-            }
-        }
-
-        // return the MEDIAN value
-        T retVal = m_pSampleBuffer[(m_sampleCount/2)];
-
-        return retVal;
+        if (this->GetSampleCount() == 0)
+            throw "Averager.GetMedian: no samples in buffer!";
+
+        return RollingWindow<T>::GetMedian();
     }
 
     // reset average window to empty
-    void Reset() { m_sampleCount = m_sampleIndex = 0; }  
+    void Reset() { this->Clear(); }  
 };
 
+// global template utility method to free an iterator entry as well as the it->Second pointer block; use this for maps whose
+// keys reference data owned by it->second
+template <class MAP, class ITERATOR>
+void EraseIteratorItemSecond(MAP &map, ITERATOR &it)
+{
+    // WARNING: must erase the map entry *before* we free it->second, since the key may reference data inside it
+    const auto pSecond = it->second;   // e.g., XRGrappleTargetVessel *
+    map.erase(it);
+    delete pSecond;
+}
+
 //----------------------------------------------------------------------------------
 
 // global template utility method to free an iterator entry as well as it->First & it->Second pointer blocks
@@ -22,8 +22,8 @@
 // ==============================================================
 // Public XR-Class Vessel Control Header File.
 // 
-// XRVesselControl Version: 4.0
-// Release Date: 15-Aug-2021
+// XRVesselControl Version: 4.1
+// Release Date: 16-Oct-2026
 //
 // Minimum XR vessel versions implementing this API version: XR1 2.0, XR2 2.0, XR5 2.0
 //
@@ -47,7 +47,7 @@ class XRVesselCtrl;
 
 // Use this floating point constant when implementing your ship's GetCtrlAPIVersion method; also, you should compare each vessel's API 
 // version against this version when you are writing interface code.
-#define THIS_XRVESSELCTRL_API_VERSION 4.0f
+#define THIS_XRVESSELCTRL_API_VERSION 4.1f
 
 /*
   Here is an example of how to use the XRVesselCtrl API:
@@ -527,6 +527,24 @@ public:
     // Returns: true on success, false if state is invalid or no crew members on board
     virtual bool SetCrossFeedMode(XRXFEED_STATE state) = 0;
 
+    //=====================================================================
+    // Methods added in API version 4.1
+    //=====================================================================
+    // Same as GetStatusScreenText, except that nothing is copied if the status screen text has not changed since the caller's last retrieval.
+    // This is intended for clients that poll the status screen text every frame.
+    //   pLinesOut, maxLinesToRetrieve: same as GetStatusScreenText
+    //   bufferSize: size of pLinesOut in bytes, including space for the terminator; nothing is ever written past this.  If the lines do not fit,
+    //               the last line copied is truncated.
+    //   versionInOut: on entry, the version returned by the caller's previous call, or 0 for the first call; on exit, the version of the text now on the status screen
+    // Returns: # of lines copied to linesOut, or -1 if the text is unchanged since versionInOut (linesOut is not modified)
+    virtual int GetStatusScreenTextIfChanged(char *pLinesOut, const int bufferSize, const int maxLinesToRetrieve, int &versionInOut) const = 0;
+
+    // Writes the PreStep/PostStep timing statistics collected so far to the vessel's log file, e.g., "XR1.log", and flushes the log
+    // so the report is on disk when this returns.  Statistics are only collected if the vessel was built with XR_PREPOSTSTEP_PROFILER
+    // defined, which is not the case for release builds.
+    // Returns: true if the report was written, false if profiling is not compiled into this vessel
+    virtual bool LogPrePostStepProfile() const = 0;
+
     //=====================================================================
 
     // TODO: add resupply / refueling support later as necessary
@@ -27,28 +27,81 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 using namespace stdext;
 using namespace std;
 
+// FNV-1a hash and equality functor for string-keyed hash tables.  Both operators take a string_view, so the same functor
+// works for maps keyed by string or by string_view, and lookups never need to construct a temporary string.
+// Note: is_transparent enables heterogeneous lookup once we build with C++20; under C++17 maps that need allocation-free
+// lookups should be keyed by string_view instead, with the key's characters owned by the mapped value.
 class stringhasher
 {
 public:
+	typedef void is_transparent;
+
 	// Returns hashcode for the supplied string
-	size_t operator() (const string *key) const
+	size_t operator() (const string_view key) const
 	{
-		size_t hash = 0;
-		for (size_t i = 0; i < (*key).size(); i++)
+		return Hash<false>(key);
+	}
+
+	// Compares two strings for equality; returns true if strings match
+	bool operator() (const string_view s1, const string_view s2) const
+	{
+		return (s1 == s2);
+	}
+
+	// FNV-1a hash of the supplied string; if IGNORE_CASE is true, each character is folded to lowercase first
+	template<bool IGNORE_CASE>
+	static size_t Hash(const string_view key)
+	{
+#ifdef _WIN64
+		const size_t fnvOffsetBasis = 14695981039346656037ULL;
+		const size_t fnvPrime = 1099511628211ULL;
+#else
+		const size_t fnvOffsetBasis = 2166136261U;
+		const size_t fnvPrime = 16777619U;
+#endif
+		size_t hash = fnvOffsetBasis;
+		for (const char c : key)
 		{
-			hash += (71 * hash + (*key)[i]) % 5;
+			hash ^= static_cast<unsigned char>(IGNORE_CASE ? ToLower(c) : c);
+			hash *= fnvPrime;
 		}
 		return hash;
 	}
 
-	// Compares two string objects for equality; returns true if strings match
-	bool operator() (const string *s1, const string *s2) const
+	// locale-independent so that the caseless hash and comparison always agree
+	static char ToLower(const char c) { return (((c >= 'A') && (c <= 'Z')) ? static_cast<char>(c - 'A' + 'a') : c); }
+};
+
+// Same as stringhasher, except that keys are compared without regard to ASCII case; use this for maps keyed by Orbiter vessel names,
+// which the core also matches case-insensitively.
+class caseless_stringhasher
+{
+public:
+	typedef void is_transparent;
+
+	// Returns hashcode for the supplied string, folded to lowercase
+	size_t operator() (const string_view key) const
+	{
+		return stringhasher::Hash<true>(key);
+	}
+
+	// Compares two strings for equality without regard to case; returns true if strings match
+	bool operator() (const string_view s1, const string_view s2) const
 	{
-		return ((*s1).compare(*s2) == 0);
+		if (s1.size() != s2.size())
+			return false;
+
+		for (size_t i = 0; i < s1.size(); i++)
+		{
+			if (stringhasher::ToLower(s1[i]) != stringhasher::ToLower(s2[i]))
+				return false;
+		}
+		return true;
 	}
 };
@@ -28,10 +28,12 @@
 #include "XRPayloadBaySlot.h"
 #include "VesselAPI.h"
 #include <vector>
+#include <algorithm>
+#include <numeric>
 
 // Constructor
 XRPayloadBay::XRPayloadBay(VESSEL &parentVessel) :
-    m_parentVessel(parentVessel)
+    m_parentVessel(parentVessel), m_propellantSnapshotSimt(-1), m_occupiedSlotMask(0), m_occupiedSlotMaskSimt(-1)
 {
 }
 
@@ -54,6 +56,7 @@ void XRPayloadBay::AddSlot(XRPayloadBaySlot *pSlot)
 {
     _ASSERTE(pSlot != nullptr);
     _ASSERTE(pSlot->GetSlotNumber() > 0);
+    _ASSERTE(pSlot->GetSlotNumber() <= MAX_SLOT_COUNT);  // must fit in a SLOTMASK
     _ASSERTE(m_allSlotsMap.find(pSlot->GetSlotNumber()) == m_allSlotsMap.end());  // assert that the slot was not already added
 
     // add to our master map
@@ -314,36 +317,104 @@ void XRPayloadBay::PerformFinalInitialization(ATTACHMENTHANDLE dummyAttachmentPo
 // attached or detached.
 void XRPayloadBay::RefreshSlotStates()
 {
+    // payload was attached or detached, so our cached propellant totals and occupied slots are stale
+    InvalidatePropellantSnapshot();
+    InvalidateOccupiedSlotMask();
+
     // First, reset all slots to ENABLED.
     for (int slotNumber=1; slotNumber <= GetSlotCount(); slotNumber++)
        GetSlot(slotNumber)->SetEnabled(true);
 
     // Second, locate and process *primary* slot with a child (i.e., a slot with a payload directly attached)
     // and disable any necessary slots.
-    vector<XRPayloadBaySlot *> vOut;  // declared here for efficiency
     for (int slotNumber=1; slotNumber <= GetSlotCount(); slotNumber++)
     {
         XRPayloadBaySlot *pSlot = GetSlot(slotNumber);
         VESSEL *pChild = pSlot->GetChild();
         if (pChild != nullptr)
         {
-            vOut.clear();       // reset
-
             // This is a primary slot with a child attached; process it and mark any surrounding slots as DISABLED if the 
-            // payload is too large for one slot.
-            // Note: we can safely typecast vOut to be a vector<const XRPayloadBaySlot *> for this call.
-            pSlot->GetRequiredNeighborSlotsForCandidateVessel(*pChild, reinterpret_cast<vector<const XRPayloadBaySlot *> &>(vOut));  // ignore return code for 'clearsHull' status: it does not matter here
+            // payload is too large for one slot.  The 'clearsHull' status does not matter here.
+            const SLOTMASK neighborSlotMask = pSlot->GetFootprint(*pChild).slotMask & ~GetSlotMask(slotNumber);
 
             // disable all occupied neighbor slots; the primary slot remains ENABLED
-            for (UINT i=0; i < vOut.size(); i++)
+            for (int neighborSlotNumber=1; neighborSlotNumber <= GetSlotCount(); neighborSlotNumber++)
             {
-                XRPayloadBaySlot *pNeighborSlot = vOut[i];
-                pNeighborSlot->SetEnabled(false);
+                if (neighborSlotMask & GetSlotMask(neighborSlotNumber))
+                    GetSlot(neighborSlotNumber)->SetEnabled(false);
             }
         }
     }
 }
 
+// Returns the set of slots that are occupied by payload, either directly or by payload attached in a neighboring slot.
+// The bay is walked at most once per frame: the mask is cached until the absolute simt changes or payload is attached or detached.
+SLOTMASK XRPayloadBay::GetOccupiedSlotMask() const
+{
+    // Note: our parent is always an XR vessel
+    const double simt = static_cast<const VESSEL3_EXT &>(GetParentVessel()).GetAbsoluteSimTime();
+    if (simt != m_occupiedSlotMaskSimt)
+    {
+        m_occupiedSlotMask = 0;
+        for (int slotNumber=1; slotNumber <= GetSlotCount(); slotNumber++)
+        {
+            if (GetSlot(slotNumber)->IsOccupied())
+                m_occupiedSlotMask |= GetSlotMask(slotNumber);
+        }
+        m_occupiedSlotMaskSimt = simt;
+    }
+
+    return m_occupiedSlotMask;
+}
+
+// Locate every slot in which the supplied payload vessel could be attached right now, best slot first.
+// The best slot is the one whose footprint overlaps the fewest other slots where this payload would also fit, which
+// leaves the most room for additional payload; ties go to the lowest slot number.
+// slotNumbersOut = OUTPUT: cleared and then populated with slot numbers (1...n)
+// Returns: number of slots found
+int XRPayloadBay::GetFreeSlotsForPayload(const VESSEL &childVessel, vector<int> &slotNumbersOut) const
+{
+    slotNumbersOut.clear();
+
+    // find every slot where the payload fits, along with the slots it would occupy there
+    vector<int> candidateSlots;
+    vector<SLOTMASK> candidateFootprints;
+    for (int slotNumber=1; slotNumber <= GetSlotCount(); slotNumber++)
+    {
+        const XRPayloadBaySlot *pSlot = GetSlot(slotNumber);
+        if (pSlot->CheckSlotSpace(childVessel))
+        {
+            candidateSlots.push_back(slotNumber);
+            candidateFootprints.push_back(pSlot->GetFootprint(childVessel).slotMask);
+        }
+    }
+
+    // count how many other candidate slots each candidate would block
+    const int candidateCount = static_cast<int>(candidateSlots.size());
+    vector<int> blockedCount(candidateCount, 0);
+    for (int i=0; i < candidateCount; i++)
+    {
+        for (int j=i+1; j < candidateCount; j++)
+        {
+            if (candidateFootprints[i] & candidateFootprints[j])
+            {
+                blockedCount[i]++;
+                blockedCount[j]++;
+            }
+        }
+    }
+
+    // candidates are already in slot number order, so a stable sort keeps the lowest slot number first on ties
+    vector<int> order(candidateCount);
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [&blockedCount](const int a, const int b) { return blockedCount[a] < blockedCount[b]; });
+
+    for (int i=0; i < candidateCount; i++)
+        slotNumbersOut.push_back(candidateSlots[order[i]]);
+
+    return candidateCount;
+}
+
 // Instantiate a new instance of a given payload vessel and attach it in the bay at the specified slot, provided there is room.
 // Returns: true on success, false if vessel could not be instantiated or attached in the specified slot
 bool XRPayloadBay::CreateAndAttachPayloadVessel(const char *pClassname, const int slotNumber)
@@ -534,28 +605,43 @@ bool XRPayloadBay::IsChildVesselAttached(OBJHANDLE hVessel) const
     return retVal;
 }
 
+// Returns the current quantity and capacity of all propellant types for all tanks in the bay.
+// The bay is walked at most once per frame: the totals are cached until the absolute simt changes, a slot's
+// propellant is adjusted via AdjustPropellantMass, or payload is attached or detached.
+const XRPayloadBay::BayPropellantSnapshot &XRPayloadBay::GetPropellantSnapshot() const
+{
+    // Note: our parent is always an XR vessel
+    const double simt = static_cast<const VESSEL3_EXT &>(GetParentVessel()).GetAbsoluteSimTime();
+    if (simt != m_propellantSnapshotSimt)
+    {
+        for (int i = 0; i < BAY_PROPELLANT_TYPE_COUNT; i++)
+            m_propellantSnapshot.mass[i] = m_propellantSnapshot.maxMass[i] = 0;
+
+        // iterate through all slots
+        for (int i=0; i < GetSlotCount(); i++)
+        {
+            const XRPayloadBaySlot *pSlot = GetSlot(i+1);  // will never be null
+            pSlot->AddPropellantMasses(m_propellantSnapshot.mass, m_propellantSnapshot.maxMass, BAY_PROPELLANT_TYPE_COUNT);
+        }
+        m_propellantSnapshotSimt = simt;
+    }
+
+    return m_propellantSnapshot;
+}
+
 // returns the maximum capacity of the indexed fuel tank for all tanks in the bay, if any
 double XRPayloadBay::GetPropellantMaxMass(const PROP_TYPE propType) const
 {
     double retVal = 0;
 
-    // iterate through all slots
-    for (int i=0; i < GetSlotCount(); i++)
-    {
-        const XRPayloadBaySlot *pSlot = GetSlot(i+1);  // will never be null
-        if (propType == PROP_TYPE::PT_Main)
-            retVal += pSlot->GetMainFuelMaxMass();
-        else if (propType == PROP_TYPE::PT_SCRAM)
-            retVal += pSlot->GetSCRAMFuelMaxMass();
-        else if (propType == PROP_TYPE::PT_LOX)
-            retVal += pSlot->GetLOXMaxMass();
-        else if (propType == PROP_TYPE::PT_NONE)
-        { 
-            // e.g., RCS: a resource that has no corresponding bay tank, so fall through with zero
-        }  
-        else  // invalid enum (should never happen)
-            _ASSERTE(false);  // break into debugger if debug build, else fall through with zero
-    }
+    if ((propType == PROP_TYPE::PT_Main) || (propType == PROP_TYPE::PT_SCRAM) || (propType == PROP_TYPE::PT_LOX))
+        retVal = GetPropellantSnapshot().maxMass[static_cast<int>(propType)];
+    else if (propType == PROP_TYPE::PT_NONE)
+    { 
+        // e.g., RCS: a resource that has no corresponding bay tank, so fall through with zero
+    }  
+    else  // invalid enum (should never happen)
+        _ASSERTE(false);  // break into debugger if debug build, else fall through with zero
     
     return retVal;
 }
@@ -565,18 +651,9 @@ double XRPayloadBay::GetPropellantMass(const PROP_TYPE propType) const
 {
     double retVal = 0;
 
-    // iterate through all slots
-    for (int i=0; i < GetSlotCount(); i++)
-    {
-        const XRPayloadBaySlot *pSlot = GetSlot(i+1);  // will never be null
-        if (propType == PROP_TYPE::PT_Main)
-            retVal += pSlot->GetMainFuelMass();
-        else if (propType == PROP_TYPE::PT_SCRAM)
-            retVal += pSlot->GetSCRAMFuelMass();
-        else if (propType == PROP_TYPE::PT_LOX)
-            retVal += pSlot->GetLOXMass();
-        // else invalid enum! (should never happen), so fall through with zero
-    }
+    if ((propType == PROP_TYPE::PT_Main) || (propType == PROP_TYPE::PT_SCRAM) || (propType == PROP_TYPE::PT_LOX))
+        retVal = GetPropellantSnapshot().mass[static_cast<int>(propType)];
+    // else invalid enum! (should never happen), so fall through with zero
     
     return retVal;
 }
@@ -585,6 +662,9 @@ double XRPayloadBay::GetPropellantMass(const PROP_TYPE propType) const
 // The resource will be drained/added to/from lowest->highest numbered slots
 const XRPayloadBay::SlotsDrainedFilled &XRPayloadBay::AdjustPropellantMass(const PROP_TYPE propType, const double quantityRequested)
 {
+    // bay quantities are about to change
+    InvalidatePropellantSnapshot();
+
     // reset any drained/filled slot data for the return value
     m_slotsDrainedFilled.quantityAdjusted = 0;
     m_slotsDrainedFilled.drainedList.clear();